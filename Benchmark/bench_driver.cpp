@@ -0,0 +1,374 @@
+/*
+ * bench_driver.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host benchmark of the driver math and SPI encoding paths. The driver runs on the Linux
+ * SpiSlave backend with LMX2492Simulator as mock device, which counts frames and bytes.
+ * Output is CSV: name, ns/op, SPI transactions (CS frames) and bytes per operation,
+ * followed by the sample throughput of LMX2492RampTrajectory::Sample().
+ * Build and run on Linux:
+ *
+ *   g++ -std=c++14 -O2 -ILMX2492 -ISpiSlave_Linux -ISimulator Benchmark/bench_driver.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o bench_driver && ./bench_driver
+ *
+ * The trajectory sampling is vectorized with -O3 only.
+ *
+ * With -DLMX2492_TRACE the SPI transactions are traced as well and the latency statistics
+ * per operation (ns) are printed after the benchmarks.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_hop_table.h"
+#include "lmx2492_chirp_compiler.h"
+#include "lmx2492_simulator.h"
+#include "lmx2492_ramp_trajectory.h"
+#include "richards_fraction.h"
+#include "best_rational.h"
+
+using namespace bsp;
+
+#define BENCH_ITERATIONS	20000
+#define BENCH_FREF			32000000
+#define BENCH_HOPS			16
+#define BENCH_TRACE_SIZE	256
+#define BENCH_SAMPLES		65536
+
+// Keep results alive
+static volatile uint32_t sink;
+
+// Benchmarked operation, returns false on failure
+typedef bool (*BenchFunction)(void* context, uint32_t i);
+
+static double now_ns()
+{
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Run an operation and print one CSV line, SPI counters are taken from sim (NULL for pure math)
+static void run(const char* name, BenchFunction function, void* context, LMX2492Simulator* sim, uint32_t iterations = BENCH_ITERATIONS)
+{
+	bool ok = true;
+
+	if(sim != NULL)
+		sim->ResetCounters();
+
+	double t0 = now_ns();
+
+	for(uint32_t i = 0; i < iterations; ++i)
+		ok &= function(context, i);
+
+	double ns = (now_ns() - t0) / iterations;
+
+	double frames = (sim != NULL) ? (double)sim->Frames() / iterations : 0;
+	double bytes = (sim != NULL) ? (double)sim->Bytes() / iterations : 0;
+
+	printf("%s,%.1f,%.2f,%.2f,%.2f,%d\n", name, ns, frames, bytes, (frames > 0) ? bytes / frames : 0, ok ? 1 : 0);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Math
+
+static bool bench_simple_config(void*, uint32_t i)
+{
+	LMX2492_Config_TypeDef config;
+	LMX2492Driver::SimpleConfig(&config, 1.6e9f + i * 1000.0f, 32e6f, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+	sink = config.FRAC_NUM_7_0;
+	return true;
+}
+
+static bool bench_simple_config_hz(void*, uint32_t i)
+{
+	LMX2492_Config_TypeDef config;
+	sink = (uint32_t)LMX2492Driver::SimpleConfigHz(&config, 1600000000ULL + i * 1000ULL, BENCH_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+	return true;
+}
+
+static bool bench_divider(void*, uint32_t i)
+{
+	uint32_t N, num, den;
+	LMX2492Driver::DividerFromFrequency(1.6e9f + i * 1000.0f, 32e6f, N, num, den);
+	sink = num;
+	return true;
+}
+
+static bool bench_divider_hz(void*, uint32_t i)
+{
+	uint32_t N, num, den;
+	sink = (uint32_t)LMX2492Driver::DividerFromFrequencyHz(1600000000ULL + i * 1000ULL, BENCH_FREF, N, num, den);
+	return true;
+}
+
+static bool bench_ramp(void*, uint32_t i)
+{
+	uint32_t INC;
+	uint16_t LEN;
+	LMX2492Driver::RampFromFrequency(1.6e9f - i * 1000.0f, 32e6f, 1e-3f, INC, LEN);
+	sink = INC;
+	return true;
+}
+
+static bool bench_ramp_hz(void*, uint32_t i)
+{
+	uint32_t INC;
+	uint16_t LEN;
+	sink = (uint32_t)LMX2492Driver::RampFromFrequencyHz(1600000000LL - i * 1000LL, BENCH_FREF, 1000000, INC, LEN);
+	return true;
+}
+
+static bool bench_richards(void*, uint32_t i)
+{
+	uint32_t num, den;
+	richards_fraction((float)((uint32_t)(i * 2654435761UL) >> 8) / 16777216.0f, num, den);
+	sink = num;
+	return true;
+}
+
+static bool bench_best_rational(void*, uint32_t i)
+{
+	uint32_t num, den;
+	best_rational((uint32_t)(i * 2654435761UL) >> 8, 1UL << 24, BEST_RATIONAL_MAX_DEN, num, den, 1);
+	sink = num;
+	return true;
+}
+
+static bool bench_encode(void*, uint32_t i)
+{
+	uint8_t data[LMX2492_REGISTER_COUNT];
+	uint8_t frame[LMX2492_FRAME_MAX_SIZE];
+
+	data[0] = (uint8_t)i;
+	sink = (uint32_t)LMX2492Driver::EncodeFrame(0, data, sizeof(data), frame) + frame[2];
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Trajectory
+
+typedef struct {
+	LMX2492RampTrajectory* trajectory;
+	double samples[BENCH_SAMPLES];
+} TrajectoryContext;
+
+// One block of samples at 10 MHz over the chirp
+static bool bench_trajectory_sample(void* context, uint32_t i)
+{
+	TrajectoryContext* c = (TrajectoryContext*)context;
+
+	c->trajectory->Sample((i % 64) * 1e-6, 10e6, c->samples, BENCH_SAMPLES);
+	sink = (uint32_t)c->samples[i % BENCH_SAMPLES];
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// SPI workloads
+
+typedef struct {
+	LMX2492Driver* pll;
+	LMX2492_Config_TypeDef config;
+	LMX2492_GPIO_Config_TypeDef gpio_config;
+	LMX2492_Ramp_Config_TypeDef ramp_config;
+	LMX2492_Ramp_TypeDef ramps[LMX2492_RAMP_COUNT];
+	LMX2492HopTable* hops;
+	uint64_t hop_frequencies[BENCH_HOPS];
+} BenchContext;
+
+// Boot as in Example_STM32_HAL: reset, ramps, ramp config, GPIO config, config, power up
+static bool bench_boot(void* context, uint32_t)
+{
+	BenchContext* c = (BenchContext*)context;
+	bool ok = c->pll->Reset();
+
+	for(int8_t i = 2; i >= 0; --i)
+		ok &= c->pll->WriteRamp(&c->ramps[i], i);
+
+	ok &= c->pll->WriteRampConfig(&c->ramp_config);
+	ok &= c->pll->WriteGPIOConfig(&c->gpio_config);
+	ok &= c->pll->WriteConfig(&c->config);
+	ok &= c->pll->WritePowerConfig(LMX2492_POWERDOWN_POWER_UP);
+
+	return ok;
+}
+
+// Same boot staged in the register image and sent by Commit()
+static bool bench_boot_commit(void* context, uint32_t)
+{
+	BenchContext* c = (BenchContext*)context;
+	bool ok = c->pll->Reset();
+
+	for(uint8_t i = 0; i < 3; ++i)
+		c->pll->StageRamp(&c->ramps[i], i);
+
+	c->pll->StageRampConfig(&c->ramp_config);
+	c->pll->StageGPIOConfig(&c->gpio_config);
+	c->pll->StageConfig(&c->config);
+	c->pll->StagePowerConfig(LMX2492_POWERDOWN_POWER_UP);
+
+	return ok && c->pll->Commit();
+}
+
+// Frequency hop rebuilding the config and writing it completely
+static bool bench_hop_config(void* context, uint32_t i)
+{
+	BenchContext* c = (BenchContext*)context;
+	LMX2492_Config_TypeDef config;
+
+	LMX2492Driver::SimpleConfigHz(&config, c->hop_frequencies[i % BENCH_HOPS], BENCH_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+
+	return c->pll->WriteConfig(&config);
+}
+
+// Frequency hop rebuilding the config, only changed bytes sent by Commit()
+static bool bench_hop_commit(void* context, uint32_t i)
+{
+	BenchContext* c = (BenchContext*)context;
+	LMX2492_Config_TypeDef config;
+
+	LMX2492Driver::SimpleConfigHz(&config, c->hop_frequencies[i % BENCH_HOPS], BENCH_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+	c->pll->StageConfig(&config);
+
+	return c->pll->Commit();
+}
+
+// Frequency hop from the precomputed hop table
+static bool bench_hop_table(void* context, uint32_t i)
+{
+	BenchContext* c = (BenchContext*)context;
+
+	return c->pll->Hop(c->hops, i % BENCH_HOPS);
+}
+
+// Upload of all eight ramps slot by slot
+static bool bench_chirp_upload(void* context, uint32_t)
+{
+	BenchContext* c = (BenchContext*)context;
+	bool ok = true;
+
+	for(uint8_t i = 0; i < LMX2492_RAMP_COUNT; ++i)
+		ok &= c->pll->WriteRamp(&c->ramps[i], i);
+
+	return ok;
+}
+
+// Upload of all eight ramps in one burst
+static bool bench_chirp_burst(void* context, uint32_t)
+{
+	BenchContext* c = (BenchContext*)context;
+
+	return c->pll->WriteRamps(c->ramps);
+}
+
+// Full re-init: reset and rewrite everything from the register image
+static bool bench_reinit(void* context, uint32_t)
+{
+	BenchContext* c = (BenchContext*)context;
+
+	return c->pll->Reset() && c->pll->Commit();
+}
+
+int main()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+
+	BenchContext c;
+	c.pll = &pll;
+
+#ifdef LMX2492_TRACE
+	static LMX2492_Trace_Record_TypeDef trace_records[BENCH_TRACE_SIZE];
+	LMX2492Trace trace(trace_records, BENCH_TRACE_SIZE);
+	LMX2492Trace::Start();
+	pll.SetTrace(&trace);
+#endif
+
+	LMX2492Driver::SimpleConfigHz(&c.config, 1600000000ULL, BENCH_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+	LMX2492Driver::SimpleGPIOConfig(&c.gpio_config, LMX2492_MUX_IN_MOD, LMX2492_PIN_INPUT, LMX2492_MUX_IN_TRIG1, LMX2492_PIN_INPUT);
+	LMX2492Driver::SimpleRampConfig(&c.ramp_config, LMX2492_RAMP_EN_ENABLE, LMX2492_RAMP_CLK_PD, LMX2492_RAMP_TRIG_TRIG1_RISING, 0);
+
+	// Chirp of the example in all eight slots
+	LMX2492ChirpCompiler compiler(BENCH_FREF);
+	LMX2492_Chirp_Segment_TypeDef program[] = {
+		LMX2492ChirpCompiler::Wait(LMX2492_RAMPx_NEXT_TRIG_TRIG_A),
+		LMX2492ChirpCompiler::Sweep(1600000000LL, 1000000),
+		LMX2492ChirpCompiler::Hold(31250),
+		LMX2492ChirpCompiler::Sweep(-1600000000LL, 6000000),
+		LMX2492ChirpCompiler::Loop(0)
+	};
+
+	if(!compiler.Compile(program, sizeof(program) / sizeof(program[0])))
+		return 1;
+
+	for(uint8_t i = 0; i < LMX2492_RAMP_COUNT; ++i)
+		c.ramps[i] = compiler.Ramps()[i];
+
+	LMX2492_Hop_TypeDef hop_entries[BENCH_HOPS];
+	LMX2492HopTable hops(hop_entries, BENCH_HOPS);
+
+	for(uint32_t i = 0; i < BENCH_HOPS; ++i)
+		c.hop_frequencies[i] = 1600000000ULL + i * 12345678ULL;
+
+	if(!hops.Build(&c.config, BENCH_FREF, c.hop_frequencies, BENCH_HOPS))
+		return 1;
+
+	c.hops = &hops;
+
+	printf("name,ns_per_op,transactions,bytes,bytes_per_transaction,ok\n");
+
+	run("math_simple_config_float", bench_simple_config, NULL, NULL);
+	run("math_simple_config_hz", bench_simple_config_hz, NULL, NULL);
+	run("math_divider_float", bench_divider, NULL, NULL);
+	run("math_divider_hz", bench_divider_hz, NULL, NULL);
+	run("math_ramp_float", bench_ramp, NULL, NULL);
+	run("math_ramp_hz", bench_ramp_hz, NULL, NULL);
+	run("math_richards_fraction", bench_richards, NULL, NULL);
+	run("math_best_rational", bench_best_rational, NULL, NULL);
+	run("encode_frame_full_map", bench_encode, NULL, NULL);
+
+	run("boot_write", bench_boot, &c, &sim);
+	run("boot_commit", bench_boot_commit, &c, &sim);
+
+	// Start hops from the staged boot image
+	bench_boot_commit(&c, 0);
+
+	run("hop_write_config", bench_hop_config, &c, &sim);
+	run("hop_commit", bench_hop_commit, &c, &sim);
+	run("hop_table", bench_hop_table, &c, &sim);
+
+	run("chirp_upload_per_slot", bench_chirp_upload, &c, &sim);
+	run("chirp_upload_burst", bench_chirp_burst, &c, &sim);
+
+	run("reinit_commit", bench_reinit, &c, &sim);
+
+	// Sample throughput of the chirp trajectory, triggered at 1 us and 10 ms
+	static TrajectoryContext t;
+	LMX2492RampTrajectory trajectory(&c.ramp_config, c.ramps, BENCH_FREF);
+	const double triggers[] = { 1e-6, 10e-3 };
+	trajectory.SetTrigger(LMX2492_RAMPx_NEXT_TRIG_TRIG_A, triggers, 2);
+	trajectory.Build(20e-3);
+	t.trajectory = &trajectory;
+
+	const uint32_t blocks = 200;
+	double t0 = now_ns();
+
+	for(uint32_t i = 0; i < blocks; ++i)
+		bench_trajectory_sample(&t, i);
+
+	double ns = (now_ns() - t0) / blocks;
+
+	printf("\nname,ns_per_op,samples_per_op,msamples_per_s\n");
+	printf("trajectory_sample,%.1f,%d,%.1f\n", ns, BENCH_SAMPLES, BENCH_SAMPLES * 1e3 / ns);
+
+#ifdef LMX2492_TRACE
+	static char dump[4096];
+	trace.Dump(dump, sizeof(dump));
+	printf("\nop,count,failures,bytes,ticks,ticks_max,histogram\n%s", dump);
+	printf("dropped,%lu\n", (unsigned long)trace.Dropped());
+#endif
+
+	return 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * bench_fraction.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host benchmark of the FRAC_NUM / FRAC_DEN approximation: richards_fraction (float)
+ * against best_rational (integer). best_rational_worst times the input with the max. iteration
+ * count, a ratio of consecutive Fibonacci numbers. Build and run on Linux:
+ *
+ *   g++ -std=c++14 -O2 -ILMX2492 Benchmark/bench_fraction.cpp -o bench_fraction && ./bench_fraction
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "richards_fraction.h"
+#include "best_rational.h"
+
+#define BENCH_COUNT		100000
+#define BENCH_DEN		(1UL << 24)
+
+// Keep results alive
+static volatile uint32_t sink;
+
+static double now_ns()
+{
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main()
+{
+	// Fractional parts of divider values, p / 2^24 with a deterministic LCG
+	std::vector<uint32_t> p(BENCH_COUNT);
+	std::vector<float> x(BENCH_COUNT);
+	std::vector<uint32_t> num(BENCH_COUNT), den(BENCH_COUNT);
+
+	uint32_t lcg = 12345;
+
+	for(size_t i = 0; i < BENCH_COUNT; ++i)
+	{
+		lcg = lcg * 1664525 + 1013904223;
+		p[i] = lcg >> 8;
+		x[i] = (float)p[i] / (float)BENCH_DEN;
+	}
+
+	// richards_fraction
+	uint32_t richards_iter = 0, richards_over = 0;
+	double richards_err = 0;
+	double t0 = now_ns();
+
+	for(size_t i = 0; i < BENCH_COUNT; ++i)
+	{
+		uint32_t iter = richards_fraction(x[i], num[i], den[i]);
+		if(iter > richards_iter) richards_iter = iter;
+	}
+
+	double richards_ns = (now_ns() - t0) / BENCH_COUNT;
+
+	for(size_t i = 0; i < BENCH_COUNT; ++i)
+	{
+		if(den[i] > BEST_RATIONAL_MAX_DEN) ++richards_over;
+		richards_err = fmax(richards_err, fabs((double)num[i] / den[i] - (double)p[i] / BENCH_DEN));
+	}
+
+	// best_rational, batch and tolerance of one 2^-24 step
+	double best_err = 0;
+	t0 = now_ns();
+
+	uint32_t best_iter = best_rational_batch(p.data(), BENCH_DEN, BENCH_COUNT, BEST_RATIONAL_MAX_DEN, num.data(), den.data(), 1);
+
+	double best_ns = (now_ns() - t0) / BENCH_COUNT;
+
+	for(size_t i = 0; i < BENCH_COUNT; ++i)
+		best_err = fmax(best_err, fabs((double)num[i] / den[i] - (double)p[i] / BENCH_DEN));
+
+	// best_rational without tolerance
+	t0 = now_ns();
+
+	uint32_t exact_iter = best_rational_batch(p.data(), BENCH_DEN, BENCH_COUNT, BEST_RATIONAL_MAX_DEN, num.data(), den.data());
+
+	double exact_ns = (now_ns() - t0) / BENCH_COUNT;
+	double exact_err = 0;
+
+	for(size_t i = 0; i < BENCH_COUNT; ++i)
+		exact_err = fmax(exact_err, fabs((double)num[i] / den[i] - (double)p[i] / BENCH_DEN));
+
+	// Worst case: ratio of consecutive Fibonacci numbers, all continued fraction terms are 1
+	uint32_t fa = 1, fb = 1;
+
+	while(fb < 0x7FFFFFFF)
+	{
+		uint32_t fc = fa + fb;
+		fa = fb;
+		fb = fc;
+	}
+
+	// Measured max. cost, volatile input keeps the calls from being folded
+	volatile uint32_t worst_p = fa, worst_q = fb;
+	uint32_t wn = 0, wd = 0, worst_iter = 0;
+	t0 = now_ns();
+
+	for(size_t i = 0; i < BENCH_COUNT; ++i)
+	{
+		worst_iter = best_rational(worst_p, worst_q, BEST_RATIONAL_MAX_DEN, wn, wd);
+		sink = wn + wd;
+	}
+
+	double worst_ns = (now_ns() - t0) / BENCH_COUNT;
+	sink = wn + wd + num[0] + den[0];
+
+	// Machine readable: name, ns/op, max. iterations, max. error, results with den > 2^24 - 1
+	printf("name,ns_per_op,max_iter,max_error,den_overflow\n");
+	printf("richards_fraction,%.1f,%u,%.3g,%u\n", richards_ns, richards_iter, richards_err, richards_over);
+	printf("best_rational_tol1,%.1f,%u,%.3g,0\n", best_ns, best_iter, best_err);
+	printf("best_rational_exact,%.1f,%u,%.3g,0\n", exact_ns, exact_iter, exact_err);
+	printf("best_rational_worst,%.1f,%u,%.3g,0\n", worst_ns, worst_iter, fabs((double)wn / wd - (double)fa / fb));
+
+	return 0;
+}
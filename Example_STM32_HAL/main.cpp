@@ -13,6 +13,22 @@
 // Hardware device instance, GPIO defines by CubeMX
 bsp::LMX2492Driver pll(SPI1, PLL_nCS_GPIO_Port, PLL_nCS_Pin);
 
+// Forward HAL SPI DMA interrupts to the SpiSlave instances (asynchronous transfers)
+extern "C" void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+	bsp::SpiSlave::SpiIrqHandler(hspi, true);
+}
+
+extern "C" void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+	bsp::SpiSlave::SpiIrqHandler(hspi, true);
+}
+
+extern "C" void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+	bsp::SpiSlave::SpiIrqHandler(hspi, false);
+}
+
 // Initialize the PLL
 void _init_lmx2492()
 {
@@ -0,0 +1,115 @@
+/*
+ * best_rational.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_BEST_RATIONAL_H_
+#define LMX2492_BEST_RATIONAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
+
+// Max. FRAC_DEN of the LMX2492
+#define BEST_RATIONAL_MAX_DEN	0xFFFFFF
+
+// Iteration bound for p < q < 2^32: the convergent denominators grow at least like the
+// Fibonacci numbers, F(48) > 2^32. With max_den = BEST_RATIONAL_MAX_DEN the loop ends after
+// at most 37 iterations (F(37) > 2^24), reached by ratios of consecutive Fibonacci numbers.
+//
+// Worst case cost, no floating point. Estimated from the code GCC -O2 generates, not measured
+// on a target: an iteration is one 32 bit division, four 32 x 32 -> 64 bit multiplications and
+// 64 bit compares, the semiconvergent step adds one division and seven multiplications.
+//   Cortex-M4 (UDIV <= 12, UMULL 1 cycle):				~36 cycles / iteration,
+//     ~1400 cycles for 37 iterations, ~1800 for 48
+//   Cortex-M0 (__aeabi_uidiv <= ~130, 64 bit product ~40 cycles):	~330 cycles / iteration,
+//     ~12600 cycles for 37 iterations, ~16300 for 48
+// bench_fraction reports the measured time of the worst case input on the host.
+#define BEST_RATIONAL_MAX_ITER	48
+
+// Best rational approximation num / den of p / q (p < q) with den <= max_den by continued
+// fractions, the last convergent is refined by the best semiconvergent.
+// Stops at the first convergent within tolerance / q of p / q (0 for the best approximation).
+// Returns the iteration count.
+constexpr uint32_t best_rational(uint32_t p, uint32_t q, uint32_t max_den, uint32_t& num, uint32_t& den, uint32_t tolerance = 0)
+{
+	assert(q > 0);
+	assert(p < q);
+	assert(max_den > 0);
+
+	// Convergents h1 / k1 and their predecessors h0 / k0
+	uint32_t h0 = 0, k0 = 1, h1 = 1, k1 = 0;
+	uint32_t x = p, y = q;
+	uint32_t i = 0;
+
+	for(; (i < BEST_RATIONAL_MAX_ITER) && (y != 0); ++i)
+	{
+		uint32_t a = x / y;
+		uint64_t k2 = (uint64_t)a * k1 + k0;
+
+		if(k2 > max_den)
+		{
+			// Best semiconvergent within the denominator limit
+			uint32_t m = (max_den - k0) / k1;
+			uint64_t hs = (uint64_t)m * h1 + h0, ks = (uint64_t)m * k1 + k0;
+
+			// Compare |p/q - h/k| by cross multiplication, all products stay below 2^57
+			uint64_t ds = ((uint64_t)p * ks > (uint64_t)q * hs) ? ((uint64_t)p * ks - (uint64_t)q * hs) : ((uint64_t)q * hs - (uint64_t)p * ks);
+			uint64_t d1 = ((uint64_t)p * k1 > (uint64_t)q * h1) ? ((uint64_t)p * k1 - (uint64_t)q * h1) : ((uint64_t)q * h1 - (uint64_t)p * k1);
+
+			if(ds * k1 < d1 * ks)
+			{
+				h1 = (uint32_t)hs;
+				k1 = (uint32_t)ks;
+			}
+
+			++i;
+			break;
+		}
+
+		uint32_t h2 = a * h1 + h0;
+		h0 = h1; k0 = k1;
+		h1 = h2; k1 = (uint32_t)k2;
+
+		uint32_t r = x - a * y;
+		x = y;
+		y = r;
+
+		// Close enough: |p * k - q * h| <= tolerance * k
+		uint64_t d = ((uint64_t)p * k1 > (uint64_t)q * h1) ? ((uint64_t)p * k1 - (uint64_t)q * h1) : ((uint64_t)q * h1 - (uint64_t)p * k1);
+
+		if(d <= (uint64_t)tolerance * k1)
+		{
+			++i;
+			break;
+		}
+	}
+
+	num = h1;
+	den = k1;
+
+	return i;
+}
+
+// Best rational approximations of p[i] / q with a common denominator, e.g. the fractional
+// parts of many divider values for the same fPFD. Returns the max. iteration count.
+inline uint32_t best_rational_batch(const uint32_t* p, uint32_t q, size_t count, uint32_t max_den, uint32_t* num, uint32_t* den, uint32_t tolerance = 0)
+{
+	assert((p != NULL) && (num != NULL) && (den != NULL));
+
+	uint32_t max_iter = 0;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		uint32_t iter = best_rational(p[i], q, max_den, num[i], den[i], tolerance);
+
+		if(iter > max_iter)
+			max_iter = iter;
+	}
+
+	return max_iter;
+}
+
+#endif /* LMX2492_BEST_RATIONAL_H_ */
@@ -0,0 +1,226 @@
+/*
+ * lmx2492_chirp_compiler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_chirp_compiler.h>
+#include <lmx2492_driver.h>
+#include <lmx2492_plan.h>
+
+#include <assert.h>
+#include "string.h"
+
+namespace bsp {
+
+LMX2492ChirpCompiler::LMX2492ChirpCompiler(uint32_t fref, uint16_t R, uint8_t OSC_2X, uint32_t finc)
+ : fref_(fref), R_(R), osc_2x_(OSC_2X), finc_(finc), slots_(0), count_(0)
+{
+	assert(fref > 0);
+	assert(R > 0);
+	assert(OSC_2X <= 0x1);
+	assert((uint64_t)fref * (OSC_2X + 1) <= 0xFFFFFFFF);
+
+	memset(ramps_, 0, sizeof(ramps_));
+	memset(inc_, 0, sizeof(inc_));
+}
+
+bool LMX2492ChirpCompiler::Emit(uint32_t INC, uint16_t LEN)
+{
+	if(slots_ >= LMX2492_RAMP_COUNT) return false;
+
+	LMX2492Driver::SimpleRamp(&ramps_[slots_], INC, LEN, (slots_ + 1) & 0x07);
+	inc_[slots_] = INC;
+	++slots_;
+
+	return true;
+}
+
+bool LMX2492ChirpCompiler::Compile(const LMX2492_Chirp_Segment_TypeDef *segments, size_t count)
+{
+	assert(segments != NULL);
+
+	memset(ramps_, 0, sizeof(ramps_));
+	memset(inc_, 0, sizeof(inc_));
+	slots_ = 0;
+	count_ = 0;
+
+	if((count == 0) || (count > LMX2492_CHIRP_MAX_SEGMENTS)) return false;
+
+	// Only the last segment may loop, and only backwards
+	int32_t loop_target = -1;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		if(segments[i].type != LMX2492_CHIRP_LOOP) continue;
+		if((i != count - 1) || (segments[i].target >= i)) return false;
+
+		loop_target = segments[i].target;
+	}
+
+	// fPFD = D / R
+	uint64_t D = (uint64_t)fref_ * (osc_2x_ + 1);
+
+	// Ramp clock finc = clk_num / clk_den
+	uint64_t clk_num = (finc_ != 0) ? finc_ : D;
+	uint64_t clk_den = (finc_ != 0) ? 1 : R_;
+	uint64_t div = clk_den * 1000000000ULL;
+
+	// Rounding residual of the cycle count in 1 / div cycles, kept within [-div / 2, div / 2)
+	int64_t cycle_residual = 0;
+	// Accumulated frequency error in mHz
+	int64_t frequency_error = 0;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		const LMX2492_Chirp_Segment_TypeDef *seg = &segments[i];
+
+		first_slot_[i] = slots_;
+
+		switch(seg->type)
+		{
+		case LMX2492_CHIRP_SWEEP:
+		case LMX2492_CHIRP_HOLD:
+		{
+			// Cycles up to the end of the segment, rounded from the accumulated time
+			uint64_t acc = (uint64_t)seg->duration * clk_num + div / 2 + cycle_residual;
+			uint64_t cycles = acc / div;
+			cycle_residual = (int64_t)(acc - cycles * div) - (int64_t)(div / 2);
+
+			if(cycles == 0) return false;
+
+			// Split into slots of equal length
+			uint64_t k = (cycles + 0xFFFE) / 0xFFFF;
+			if(slots_ + k > LMX2492_RAMP_COUNT) return false;
+
+			uint32_t INC = 0;
+
+			if(seg->type == LMX2492_CHIRP_SWEEP)
+			{
+				// Correct the error accumulated by the previous sweeps
+				int64_t target = seg->df * 1000 - frequency_error;
+				uint64_t mag = (uint64_t)(((target < 0) ? -target : target) + 500) / 1000;
+
+				// INC = df / fPFD * 2^24 / cycles, must fit the 30 bit two's complement register
+				if((mag * R_) / (D * cycles) >= 32) return false;
+
+				uint64_t inc = LMX2492Plan::ScaleFrac24(mag * R_, D * cycles);
+				if(inc > 0x1FFFFFFF) return false;
+
+				INC = (uint32_t)((target < 0) ? ((0x40000000 - inc) & 0x3FFFFFFF) : inc);
+
+				frequency_error += LMX2492Driver::RampDeltaHz(INC, (uint32_t)cycles, fref_, R_, osc_2x_) - seg->df * 1000;
+			}
+
+			for(uint64_t j = 0; j < k; ++j)
+				Emit(INC, (uint16_t)(cycles / k + ((j < cycles % k) ? 1 : 0)));
+
+			break;
+		}
+
+		case LMX2492_CHIRP_WAIT:
+			if((seg->target < LMX2492_RAMPx_NEXT_TRIG_TRIG_A) || (seg->target > LMX2492_RAMPx_NEXT_TRIG_TRIG_C)) return false;
+
+			// Wait in an own hold slot at the program start, at a loop target, after a sweep or after another wait
+			if((slots_ == 0) || ((int32_t)i == loop_target) || (inc_[slots_ - 1] != 0)
+					|| (LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(&ramps_[slots_ - 1]) != LMX2492_RAMPx_NEXT_TRIG_NONE))
+			{
+				if(!Emit(0, LMX2492_CHIRP_WAIT_LEN)) return false;
+			}
+
+			LMX2492RampFieldSet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(&ramps_[slots_ - 1], seg->target);
+			break;
+
+		case LMX2492_CHIRP_LOOP:
+			if((slots_ == 0) || (first_slot_[seg->target] >= slots_)) return false;
+
+			// The accumulator is cleared when the target slot starts
+			LMX2492RampFieldSet<LMX2492_FIELD_RAMP0_NEXT>(&ramps_[slots_ - 1], first_slot_[seg->target]);
+			LMX2492RampFieldSet<LMX2492_FIELD_RAMP0_RST>(&ramps_[first_slot_[seg->target]], seg->reset);
+			break;
+
+		default:
+			return false;
+		}
+
+		// Achieved minus requested, residual / clk_num is the time error in ns
+		frequency_error_[i] = frequency_error;
+		timing_error_[i] = (cycle_residual >= 0) ? -((cycle_residual + (int64_t)clk_num / 2) / (int64_t)clk_num)
+				: (-cycle_residual + (int64_t)clk_num / 2) / (int64_t)clk_num;
+	}
+
+	if(slots_ == 0) return false;
+
+	// Stay at the final frequency
+	if(loop_target < 0)
+	{
+		if((inc_[slots_ - 1] != 0) || (LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(&ramps_[slots_ - 1]) != LMX2492_RAMPx_NEXT_TRIG_NONE))
+		{
+			if(!Emit(0, LMX2492_CHIRP_WAIT_LEN)) return false;
+		}
+
+		LMX2492RampFieldSet<LMX2492_FIELD_RAMP0_NEXT>(&ramps_[slots_ - 1], slots_ - 1);
+	}
+
+	count_ = count;
+
+	return true;
+}
+
+const LMX2492_Ramp_TypeDef* LMX2492ChirpCompiler::Ramps() const
+{
+	return ramps_;
+}
+
+uint8_t LMX2492ChirpCompiler::Slots() const
+{
+	return slots_;
+}
+
+uint8_t LMX2492ChirpCompiler::FirstSlot(size_t segment) const
+{
+	assert(segment < count_);
+
+	return first_slot_[segment];
+}
+
+int64_t LMX2492ChirpCompiler::FrequencyError(size_t segment) const
+{
+	assert(segment < count_);
+
+	return frequency_error_[segment];
+}
+
+int64_t LMX2492ChirpCompiler::TimingError(size_t segment) const
+{
+	assert(segment < count_);
+
+	return timing_error_[segment];
+}
+
+LMX2492_Chirp_Segment_TypeDef LMX2492ChirpCompiler::Sweep(int64_t df, uint32_t duration)
+{
+	LMX2492_Chirp_Segment_TypeDef seg = { LMX2492_CHIRP_SWEEP, df, duration, 0, 0 };
+	return seg;
+}
+
+LMX2492_Chirp_Segment_TypeDef LMX2492ChirpCompiler::Hold(uint32_t duration)
+{
+	LMX2492_Chirp_Segment_TypeDef seg = { LMX2492_CHIRP_HOLD, 0, duration, 0, 0 };
+	return seg;
+}
+
+LMX2492_Chirp_Segment_TypeDef LMX2492ChirpCompiler::Wait(uint8_t trigger)
+{
+	LMX2492_Chirp_Segment_TypeDef seg = { LMX2492_CHIRP_WAIT, 0, 0, trigger, 0 };
+	return seg;
+}
+
+LMX2492_Chirp_Segment_TypeDef LMX2492ChirpCompiler::Loop(uint8_t segment, uint8_t reset)
+{
+	LMX2492_Chirp_Segment_TypeDef seg = { LMX2492_CHIRP_LOOP, 0, 0, segment, reset };
+	return seg;
+}
+
+} /* namespace bsp */
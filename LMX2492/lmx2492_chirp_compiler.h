@@ -0,0 +1,102 @@
+/*
+ * lmx2492_chirp_compiler.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_CHIRP_COMPILER_H_
+#define LMX2492_CHIRP_COMPILER_H_
+
+#include <lmx2492_regdef.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Chirp segment types
+#define LMX2492_CHIRP_SWEEP		0
+#define LMX2492_CHIRP_HOLD		1
+#define LMX2492_CHIRP_WAIT		2
+#define LMX2492_CHIRP_LOOP		3
+
+// Max. number of segments of a chirp program
+#define LMX2492_CHIRP_MAX_SEGMENTS	16
+
+// Length of the hold slots inserted for trigger waits and the program end
+// (ramps shorter than 2 cycles do not wait for the trigger reliably)
+#define LMX2492_CHIRP_WAIT_LEN		2
+
+namespace bsp
+{
+
+	// Chirp program segment
+	typedef struct {
+		uint8_t type;
+		// SWEEP: frequency delta in Hz
+		int64_t df;
+		// SWEEP, HOLD: duration in ns
+		uint32_t duration;
+		// WAIT: LMX2492_RAMPx_NEXT_TRIG_TRIG_A ... C, LOOP: index of the segment to continue with
+		uint8_t target;
+		// LOOP: return to the start frequency (RAMPx_RST)
+		uint8_t reset;
+	} LMX2492_Chirp_Segment_TypeDef;
+
+	// Compiles a chirp program into the eight ramp slots.
+	// Long segments are split over several slots, INC and LEN are chosen so that
+	// the frequency and timing errors do not accumulate over the program.
+	// A WAIT is attached to a preceding hold slot, otherwise a hold slot is inserted
+	// so that the frequency does not keep ramping while waiting for the trigger. A LOOP must be the last segment,
+	// programs without LOOP end in a hold slot at the final frequency.
+	class LMX2492ChirpCompiler
+	{
+	public:
+		// finc .. ramp increment frequency in Hz (set to zero if fPFD is used)
+		LMX2492ChirpCompiler(uint32_t fref, uint16_t R = 1, uint8_t OSC_2X = 0, uint32_t finc = 0);
+
+		// Compile a program, returns false if it does not fit the ramp slots
+		// or an increment exceeds the 30 bit two's complement range.
+		bool Compile(const LMX2492_Chirp_Segment_TypeDef* segments, size_t count);
+
+		// All ramp slots (0x56 ... 0x8D), unused slots are zero
+		const LMX2492_Ramp_TypeDef* Ramps() const;
+
+		// Number of used ramp slots
+		uint8_t Slots() const;
+
+		// First ramp slot of a segment
+		uint8_t FirstSlot(size_t segment) const;
+
+		// Accumulated frequency error at the end of a segment in mHz
+		int64_t FrequencyError(size_t segment) const;
+
+		// Accumulated timing error at the end of a segment in ns
+		int64_t TimingError(size_t segment) const;
+
+		// Segment helpers
+		static LMX2492_Chirp_Segment_TypeDef Sweep(int64_t df, uint32_t duration);
+		static LMX2492_Chirp_Segment_TypeDef Hold(uint32_t duration);
+		static LMX2492_Chirp_Segment_TypeDef Wait(uint8_t trigger);
+		static LMX2492_Chirp_Segment_TypeDef Loop(uint8_t segment, uint8_t reset = LMX2492_RAMPx_RST_ENABLE);
+
+	private:
+		uint32_t fref_;
+		uint16_t R_;
+		uint8_t osc_2x_;
+		uint32_t finc_;
+
+		LMX2492_Ramp_TypeDef ramps_[LMX2492_RAMP_COUNT];
+		uint32_t inc_[LMX2492_RAMP_COUNT];
+		uint8_t slots_;
+
+		size_t count_;
+		uint8_t first_slot_[LMX2492_CHIRP_MAX_SEGMENTS];
+		int64_t frequency_error_[LMX2492_CHIRP_MAX_SEGMENTS];
+		int64_t timing_error_[LMX2492_CHIRP_MAX_SEGMENTS];
+
+		// Append a slot continuing with the next slot
+		bool Emit(uint32_t INC, uint16_t LEN);
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_CHIRP_COMPILER_H_ */
@@ -8,14 +8,77 @@
 #include <lmx2492_driver.h>
 
 #include <assert.h>
-#include "richards_fraction.h"
+#include "best_rational.h"
+#include "lmx2492_plan.h"
 #include "string.h"
 
 namespace bsp {
 
-LMX2492Driver::LMX2492Driver(SPI_TypeDef *spi_instance, GPIO_TypeDef *cs_port, uint16_t cs_pin)
- : SpiSlave(spi_instance, cs_port, cs_pin)
-{ }
+// Bit mask helpers for the register image masks
+static inline bool mask_get(const uint8_t *mask, uint16_t address)
+{
+	return (mask[address >> 3] >> (address & 0x07)) & 0x01;
+}
+
+static inline void mask_set(uint8_t *mask, uint16_t address)
+{
+	mask[address >> 3] |= (uint8_t)(1 << (address & 0x07));
+}
+
+static inline void mask_clear(uint8_t *mask, uint16_t address)
+{
+	mask[address >> 3] &= (uint8_t)~(1 << (address & 0x07));
+}
+
+// P * D / R as 24 bit fixed point in mHz, rounded to nearest. P < 2^48 and D < 2^33
+// keep the partial products within 64 bits.
+static uint64_t frac24_mhz(uint64_t P, uint64_t D, uint16_t R)
+{
+	uint64_t lo = (P & 0xFFFFFF) * D;
+	uint64_t hi = (P >> 24) * D + (lo >> 24);
+	uint64_t frac = lo & 0xFFFFFF;
+
+	return (hi / R) * 1000 + (((hi % R) * 1000 + ((frac * 1000) >> 24) + R / 2) / R);
+}
+
+// 33 bit two's complement to int64_t
+static inline int64_t sign_extend33(uint64_t value)
+{
+	return (value & 0x100000000ULL) ? (int64_t)value - 0x200000000LL : (int64_t)value;
+}
+
+// Address of the first register written by a frame
+static inline uint16_t frame_address(const uint8_t *frame, size_t size)
+{
+	return (uint16_t)((((frame[0] & 0x7F) << 8) | frame[1]) - (size - LMX2492_FRAME_HEADER_SIZE - 1));
+}
+
+LMX2492Driver::LMX2492Driver(SPI_TypeDef *spi_instance, GPIO_TypeDef *cs_port, uint16_t cs_pin, uint32_t max_clock)
+ : SpiSlave(spi_instance, cs_port, cs_pin, max_clock)
+{
+	// Nothing staged, device contents unknown
+	memset(image_, 0, sizeof(image_));
+	memset(shadow_, 0, sizeof(shadow_));
+	memset(image_mask_, 0, sizeof(image_mask_));
+	memset(shadow_mask_, 0, sizeof(shadow_mask_));
+
+	frame_size_ = 0;
+	async_callback_ = NULL;
+	async_context_ = NULL;
+
+	record_ = NULL;
+	record_overflow_ = false;
+	replay_ = NULL;
+
+	verify_ = false;
+
+	active_bank_ = 0;
+	bank_size_[0] = bank_size_[1] = 0;
+
+#ifdef LMX2492_TRACE
+	trace_ = NULL;
+#endif
+}
 
 LMX2492Driver::~LMX2492Driver() { }
 
@@ -23,8 +86,18 @@ bool LMX2492Driver::Reset()
 {
 	uint8_t rst = LMX2492_SWRST_RESET;
 
-	// execute soft reset
-	if(!WriteMemory(LMX2492_SWRST_ADDR, &rst, 1)) return false;
+	// execute soft reset, the reset value must not end up in the register image
+	if(!TransmitMemory(LMX2492_SWRST_ADDR, &rst, 1)) return false;
+
+	// All registers back at POR values, recorded resets are applied on replay
+	if(record_ == NULL)
+	{
+		InvalidateShadow();
+
+		// Ramp banks cleared
+		active_bank_ = 0;
+		bank_size_[0] = bank_size_[1] = 0;
+	}
 
 	// TODO: Delay required?
 
@@ -64,39 +137,780 @@ bool LMX2492Driver::WriteRamp(LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx)
 	return WriteMemory(LMX2492_RAMP_ADDRESS(ramp_idx), (uint8_t*)ramp, sizeof(LMX2492_Ramp_TypeDef));
 }
 
-bool LMX2492Driver::WriteMemory(uint16_t address, uint8_t *data, size_t size)
+bool LMX2492Driver::WriteRamps(const LMX2492_Ramp_TypeDef* ramps)
+{
+	return WriteMemory(LMX2492_RAMP_ADDRESS(0), (const uint8_t*)ramps, sizeof(LMX2492_Ramp_TypeDef) * LMX2492_RAMP_COUNT);
+}
+
+bool LMX2492Driver::WriteRampBank(uint8_t bank, const LMX2492_Ramp_TypeDef* ramps, uint8_t count)
+{
+	assert(bank <= 1);
+	assert(ramps != NULL);
+	assert((count > 0) && (count <= LMX2492_RAMP_BANK_SIZE));
+
+	LMX2492_Ramp_TypeDef relocated[LMX2492_RAMP_BANK_SIZE];
+	uint8_t first = bank * LMX2492_RAMP_BANK_SIZE;
+
+	for(uint8_t i = 0; i < count; ++i)
+	{
+		uint8_t next = (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT>(&ramps[i]);
+		assert(next < count);
+
+		relocated[i] = ramps[i];
+		LMX2492RampFieldSet<LMX2492_FIELD_RAMP0_NEXT>(&relocated[i], first + next);
+	}
+
+	if(!WriteMemory(LMX2492_RAMP_ADDRESS(first), (const uint8_t*)relocated, sizeof(LMX2492_Ramp_TypeDef) * count)) return false;
+
+	// A recorded bank is written on replay, which invalidates the bank
+	if(record_ == NULL)
+		bank_size_[bank] = count;
+
+	return true;
+}
+
+bool LMX2492Driver::SwitchRampBank()
+{
+	uint8_t idle = active_bank_ ^ 1;
+	uint8_t first = active_bank_ * LMX2492_RAMP_BANK_SIZE;
+
+	// RAMPx_NEXT is taken from the register image, which is not updated while recording
+	if(record_ != NULL) return false;
+
+	// Both banks must hold a program written by WriteRampBank()
+	if((bank_size_[idle] == 0) || (bank_size_[active_bank_] == 0)) return false;
+
+	// The NEXT byte writes below invalidate the banks, the programs stay valid
+	uint8_t bank_size[2] = { bank_size_[0], bank_size_[1] };
+	uint8_t redirected = 0;
+
+	for(uint8_t i = first; i < first + bank_size[active_bank_]; ++i)
+	{
+		LMX2492_Ramp_TypeDef ramp;
+		memcpy(&ramp, &image_[LMX2492_RAMP_ADDRESS(i)], sizeof(LMX2492_Ramp_TypeDef));
+
+		// Forward jumps stay within the bank
+		if(LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT>(&ramp) > i) continue;
+
+		LMX2492RampFieldSet<LMX2492_FIELD_RAMP0_NEXT>(&ramp, idle * LMX2492_RAMP_BANK_SIZE);
+
+		// Rewrite the byte holding RAMPx_NEXT only
+		uint16_t address = LMX2492_RAMP_LAST_ADDRESS(i);
+		if(!WriteMemory(address, &((const uint8_t*)&ramp)[address - LMX2492_RAMP_ADDRESS(i)], 1)) return false;
+		++redirected;
+	}
+
+	// The ramp would never leave the active bank
+	if(redirected == 0) return false;
+
+	bank_size_[0] = bank_size[0];
+	bank_size_[1] = bank_size[1];
+	active_bank_ = idle;
+
+	return true;
+}
+
+uint8_t LMX2492Driver::ActiveRampBank() const
+{
+	return active_bank_;
+}
+
+uint8_t LMX2492Driver::IdleRampBank() const
+{
+	return active_bank_ ^ 1;
+}
+
+void LMX2492Driver::StageConfig(const LMX2492_Config_TypeDef* config)
+{
+	StageMemory(LMX2492_CONFIG_ADDRESS, (const uint8_t*)config, sizeof(LMX2492_Config_TypeDef));
+}
+
+void LMX2492Driver::StageGPIOConfig(const LMX2492_GPIO_Config_TypeDef* gpio_config)
+{
+	StageMemory(LMX2492_GPIO_CONFIG_ADDRESS, (const uint8_t*)gpio_config, sizeof(LMX2492_GPIO_Config_TypeDef));
+}
+
+void LMX2492Driver::StageRampConfig(const LMX2492_Ramp_Config_TypeDef* ramp_config)
+{
+	StageMemory(LMX2492_RAMP_CONFIG_ADDRESS, (const uint8_t*)ramp_config, sizeof(LMX2492_Ramp_Config_TypeDef));
+}
+
+void LMX2492Driver::StageRamp(const LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx)
+{
+	assert(ramp_idx <= 7);
+
+	StageMemory(LMX2492_RAMP_ADDRESS(ramp_idx), (const uint8_t*)ramp, sizeof(LMX2492_Ramp_TypeDef));
+}
+
+void LMX2492Driver::StageRamps(const LMX2492_Ramp_TypeDef* ramps)
+{
+	StageMemory(LMX2492_RAMP_ADDRESS(0), (const uint8_t*)ramps, sizeof(LMX2492_Ramp_TypeDef) * LMX2492_RAMP_COUNT);
+}
+
+void LMX2492Driver::StagePowerConfig(uint8_t power_config)
+{
+	assert(power_config <= 2);
+
+	StageMemory(LMX2492_POWERDOWN_ADDR, &power_config, 1);
+}
+
+void LMX2492Driver::StageMemory(uint16_t address, const uint8_t *data, size_t size)
+{
+	assert(data != NULL);
+	assert(address + size <= LMX2492_REGISTER_COUNT);
+
+	memcpy(&image_[address], data, size);
+
+	while(size-- > 0)
+		mask_set(image_mask_, address++);
+}
+
+bool LMX2492Driver::IsDirty(uint16_t address) const
+{
+	if(!mask_get(image_mask_, address))
+		return false;
+
+	return !mask_get(shadow_mask_, address) || (image_[address] != shadow_[address]);
+}
+
+bool LMX2492Driver::IsStaged(uint16_t address) const
+{
+	return mask_get(image_mask_, address);
+}
+
+void LMX2492Driver::PrepareField(uint8_t field)
+{
+	const LMX2492_Field_TypeDef *f = LMX2492FieldDescriptor(field);
+
+	for(uint16_t i = f->first; i < f->first + f->parts; ++i)
+	{
+		uint16_t address = LMX2492_FIELD_PARTS[i].address;
+
+		if(mask_get(image_mask_, address))
+			continue;
+
+		image_[address] = mask_get(shadow_mask_, address) ? shadow_[address] : LMX2492_RESET_IMAGE.data[address];
+		mask_set(image_mask_, address);
+	}
+}
+
+void LMX2492Driver::PrepareLatch()
+{
+	// Changes to double buffered PLL registers require a write of the latch register
+	bool latch = false;
+
+	for(uint16_t i = LMX2492_PLL_BUFFERED_ADDRESS; i <= LMX2492_PLL_BUFFERED_LAST_ADDRESS; ++i)
+		latch |= IsDirty(i);
+
+	if(!latch) return;
+
+	// Latch byte is PLL_N[7:0], staged with the known device contents if not staged yet
+	if(!mask_get(image_mask_, LMX2492_PLL_LATCH_ADDR))
+	{
+		image_[LMX2492_PLL_LATCH_ADDR] = mask_get(shadow_mask_, LMX2492_PLL_LATCH_ADDR) ?
+				shadow_[LMX2492_PLL_LATCH_ADDR] : LMX2492_RESET_IMAGE.data[LMX2492_PLL_LATCH_ADDR];
+		mask_set(image_mask_, LMX2492_PLL_LATCH_ADDR);
+	}
+
+	mask_clear(shadow_mask_, LMX2492_PLL_LATCH_ADDR);
+}
+
+bool LMX2492Driver::Commit()
+{
+	// The complete interrupt of a pending transfer updates the shadow masks
+	if(SpiBusy()) return false;
+
+	PrepareLatch();
+
+	return CommitRange(LMX2492_LAST_ADDRESS, 0);
+}
+
+bool LMX2492Driver::CommitRange(int32_t last_address, int32_t first_address)
+{
+	// Walk the range top down, same order as the registers are transmitted
+	int32_t address = last_address;
+
+	while(address >= first_address)
+	{
+		if(!IsDirty(address))
+		{
+			--address;
+			continue;
+		}
+
+		// Extend the range downwards, bridge small gaps of unchanged staged bytes
+		int32_t last = address;
+		int32_t first = address;
+		uint8_t gap = 0;
+
+		for(--address; address >= first_address; --address)
+		{
+			if(IsDirty(address))
+			{
+				first = address;
+				gap = 0;
+			}
+			else if(mask_get(image_mask_, address) && (gap < LMX2492_COMMIT_MERGE_GAP))
+			{
+				++gap;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		if(!WriteMemory(first, &image_[first], last - first + 1)) return false;
+
+		// Continue below the range, trailing gap bytes are checked again
+		address = first - 1;
+	}
+
+	return true;
+}
+
+void LMX2492Driver::InvalidateShadow()
+{
+	memset(shadow_mask_, 0, sizeof(shadow_mask_));
+}
+
+bool LMX2492Driver::WriteMemory(uint16_t address, const uint8_t *data, size_t size)
+{
+	if(!TransmitMemory(address, data, size)) return false;
+
+	// Recorded writes update the shadow when replayed
+	if(record_ != NULL) return true;
+
+	UpdateShadow(address, data, size);
+
+	// Read back in the same burst
+	if(verify_)
+		return VerifyMemory(address, &image_[address], size);
+
+	return true;
+}
+
+void LMX2492Driver::UpdateShadow(uint16_t address, const uint8_t *data, size_t size)
+{
+	InvalidateRampBanks(address, size);
+
+	// Device and register image now hold the written data
+	memmove(&image_[address], data, size);
+	memcpy(&shadow_[address], data, size);
+
+	for(size_t i = 0; i < size; ++i)
+	{
+		mask_set(image_mask_, address + i);
+		mask_set(shadow_mask_, address + i);
+	}
+}
+
+bool LMX2492Driver::ReadMemory(uint16_t address, uint8_t *data, size_t size)
 {
 	// assert parameters
-	assert(address <= 0x8D); // Max PLL address space
-	assert(data > 0);
+	assert(data != NULL);
 	assert(size > 0);
+	assert(address + size <= LMX2492_REGISTER_COUNT); // Max PLL address space
 
-	// Point to last byte of data
-	data += (size - 1);
-	address += (size - 1);
+	// Transmit buffer still in use or recording
+	if (SpiBusy() || (record_ != NULL)) return false;
 
-	// Create transmit address array (1 bit R/~W, 15 bit address)
-	uint8_t txaddr[2] = { (uint8_t)(((uint8_t*)&address)[1] & 0x7F), ((uint8_t*)&address)[0] };
+	// Read starts at the last byte (1 bit R/~W, 15 bit address)
+	uint16_t last = address + (size - 1);
+	uint8_t txaddr[LMX2492_FRAME_HEADER_SIZE] = { (uint8_t)(((last >> 8) & 0x7F) | 0x80), (uint8_t)(last & 0xFF) };
+
+	LMX2492_TRACE_BEGIN(rec, LMX2492_TRACE_READ, address, size + LMX2492_FRAME_HEADER_SIZE);
 
 	// Configure bus
-	if (!SpiConfig(SPI_DATASIZE_8BIT, SPI_POLARITY_LOW, SPI_PHASE_1EDGE)) return false;
+	if (!SpiConfig(SPI_DATASIZE_8BIT, SPI_POLARITY_LOW, SPI_PHASE_1EDGE)) return LMX2492_TRACE_END(rec, false);
+	// Acquire the bus, the peripheral is reinitialized if configured for another device
+	if (!SpiAcquire()) return LMX2492_TRACE_END(rec, false);
+	LMX2492_TRACE_MARK(rec, configured);
 	// Begin SPI transfer
-	if (!SpiStart()) return false;
-	// Write txaddr to SPI bus
-	if (!SpiWrite(txaddr, 2)) return false;
+	if (!SpiSelect()) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
+	LMX2492_TRACE_MARK(rec, selected);
+	// Write address
+	if (!SpiWrite(txaddr, LMX2492_FRAME_HEADER_SIZE)) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
 
-	// Write data to SPI bus in reverse byte order
-	while(size-- > 0)
+	// Read data, the device sends it in descending address order
+	memset(data, 0, size);
+	if (!SpiRead(data, size)) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
+
+	// End SPI transfer
+	if (!SpiEnd()) return LMX2492_TRACE_END(rec, false);
+	(void)LMX2492_TRACE_END(rec, true);
+
+	// Restore ascending address order
+	for(size_t i = 0; i < size / 2; ++i)
 	{
-		if (!SpiWrite(data--, 1)) return false;
+		uint8_t tmp = data[i];
+		data[i] = data[size - 1 - i];
+		data[size - 1 - i] = tmp;
 	}
 
+	return true;
+}
+
+bool LMX2492Driver::ReadConfig(LMX2492_Config_TypeDef* config)
+{
+	return ReadMemory(LMX2492_CONFIG_ADDRESS, (uint8_t*)config, sizeof(LMX2492_Config_TypeDef));
+}
+
+bool LMX2492Driver::ReadGPIOConfig(LMX2492_GPIO_Config_TypeDef* gpio_config)
+{
+	return ReadMemory(LMX2492_GPIO_CONFIG_ADDRESS, (uint8_t*)gpio_config, sizeof(LMX2492_GPIO_Config_TypeDef));
+}
+
+bool LMX2492Driver::ReadRampConfig(LMX2492_Ramp_Config_TypeDef* ramp_config)
+{
+	return ReadMemory(LMX2492_RAMP_CONFIG_ADDRESS, (uint8_t*)ramp_config, sizeof(LMX2492_Ramp_Config_TypeDef));
+}
+
+bool LMX2492Driver::ReadRamp(LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx)
+{
+	assert(ramp_idx <= 7);
+
+	return ReadMemory(LMX2492_RAMP_ADDRESS(ramp_idx), (uint8_t*)ramp, sizeof(LMX2492_Ramp_TypeDef));
+}
+
+void LMX2492Driver::SetVerify(bool verify)
+{
+	verify_ = verify;
+}
+
+bool LMX2492Driver::VerifyMemory(uint16_t address, const uint8_t *data, size_t size)
+{
+	uint8_t readback[LMX2492_REGISTER_COUNT];
+
+	if(!ReadMemory(address, readback, size)) return false;
+
+	bool equal = true;
+
+	for(size_t i = 0; i < size; ++i)
+	{
+		uint8_t mask = 0xFF;
+
+		// Soft reset bit always reads back zero
+		if(address + i == LMX2492_SWRST_ADDR)
+			mask = (uint8_t)~LMX2492_SWRST_RESET;
+
+		if((readback[i] ^ data[i]) & mask)
+		{
+			mask_clear(shadow_mask_, address + i);
+			equal = false;
+		}
+	}
+
+	return equal;
+}
+
+bool LMX2492Driver::VerifyShadow()
+{
+	bool equal = true;
+	uint16_t address = 0;
+
+	// Read back each contiguous range of staged bytes in one burst
+	while(address < LMX2492_REGISTER_COUNT)
+	{
+		if(!mask_get(image_mask_, address) || !mask_get(shadow_mask_, address))
+		{
+			++address;
+			continue;
+		}
+
+		uint16_t first = address;
+
+		while((address < LMX2492_REGISTER_COUNT) && mask_get(image_mask_, address) && mask_get(shadow_mask_, address))
+			++address;
+
+		// Read failure leaves the shadow unchanged
+		if(!ReadMemory(first, &frame_[0], address - first)) return false;
+
+		for(uint16_t i = first; i < address; ++i)
+		{
+			if(frame_[i - first] != shadow_[i])
+			{
+				mask_clear(shadow_mask_, i);
+				equal = false;
+			}
+		}
+	}
+
+	return equal;
+}
+
+bool LMX2492Driver::TransmitMemory(uint16_t address, const uint8_t *data, size_t size)
+{
+	// Record instead of transmit
+	if(record_ != NULL)
+	{
+		if(record_->Append(address, data, size)) return true;
+
+		record_overflow_ = true;
+		return false;
+	}
+
+	// Transmit buffer still in use
+	if (SpiBusy()) return false;
+
+	frame_size_ = EncodeFrame(address, data, size, frame_);
+
+	return TransmitFrame();
+}
+
+bool LMX2492Driver::TransmitFrame()
+{
+	LMX2492_TRACE_BEGIN(rec, LMX2492_TRACE_WRITE, frame_address(frame_, frame_size_), frame_size_);
+
+	// Configure bus
+	if (!SpiConfig(SPI_DATASIZE_8BIT, SPI_POLARITY_LOW, SPI_PHASE_1EDGE)) return LMX2492_TRACE_END(rec, false);
+	// Acquire the bus, the peripheral is reinitialized if configured for another device
+	if (!SpiAcquire()) return LMX2492_TRACE_END(rec, false);
+	LMX2492_TRACE_MARK(rec, configured);
+	// Begin SPI transfer
+	if (!SpiSelect()) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
+	LMX2492_TRACE_MARK(rec, selected);
+	// Write address and data in a single block
+	if (!SpiWrite(frame_, frame_size_)) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
+
 	// End SPI transfer
-	if (!SpiEnd()) return false;
+	if (!SpiEnd()) return LMX2492_TRACE_END(rec, false);
+
+	return LMX2492_TRACE_END(rec, true);
+}
+
+#ifdef LMX2492_TRACE
+void LMX2492Driver::SetTrace(LMX2492Trace *trace)
+{
+	trace_ = trace;
+}
+#endif
+
+bool LMX2492Driver::WriteMemoryAsync(uint16_t address, const uint8_t *data, size_t size, SpiCallback callback, void *context)
+{
+	// Transmit buffer still in use or recording
+	if (SpiBusy() || (record_ != NULL)) return false;
+
+	frame_size_ = EncodeFrame(address, data, size, frame_);
+
+	if(!TransmitFrameAsync(callback, context)) return false;
+
+	// Register image is updated here, the complete interrupt updates the shadow only
+	StageFrame(frame_, frame_size_);
+
+	return true;
+}
+
+bool LMX2492Driver::TransmitFrameAsync(SpiCallback callback, void *context)
+{
+	async_callback_ = callback;
+	async_context_ = context;
+
+	LMX2492_TRACE_BEGIN(rec, LMX2492_TRACE_WRITE_ASYNC, frame_address(frame_, frame_size_), frame_size_);
+
+	// Configure bus
+	if (!SpiConfig(SPI_DATASIZE_8BIT, SPI_POLARITY_LOW, SPI_PHASE_1EDGE)) return LMX2492_TRACE_END(rec, false);
+	// Acquire the bus, the peripheral is reinitialized if configured for another device
+	if (!SpiAcquire()) return LMX2492_TRACE_END(rec, false);
+	LMX2492_TRACE_MARK(rec, configured);
+	// Begin SPI transfer
+	if (!SpiSelect()) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
+	LMX2492_TRACE_MARK(rec, selected);
+
+#ifdef LMX2492_TRACE
+	// Finished by AsyncComplete, possibly before SpiWriteAsync returns
+	trace_async_ = rec;
+#endif
+
+	// Start DMA, the transfer is ended in the complete interrupt
+	if (!SpiWriteAsync(frame_, frame_size_, &LMX2492Driver::AsyncComplete, this))
+	{
+		SpiEnd();
+		return LMX2492_TRACE_END(rec, false);
+	}
+
+	return true;
+}
+
+bool LMX2492Driver::Hop(const LMX2492HopTable *table, size_t index)
+{
+	assert(table != NULL);
+
+	const LMX2492_Hop_TypeDef *hop = table->Entry(index);
+
+	// Record instead of transmit
+	if(record_ != NULL)
+	{
+		if(record_->AppendFrame(hop->frame, LMX2492_HOP_FRAME_SIZE)) return true;
+
+		record_overflow_ = true;
+		return false;
+	}
+
+	// Transmit buffer still in use
+	if (SpiBusy()) return false;
+
+	// Frame is already encoded
+	memcpy(frame_, hop->frame, LMX2492_HOP_FRAME_SIZE);
+	frame_size_ = LMX2492_HOP_FRAME_SIZE;
+
+	if(!TransmitFrame()) return false;
+
+	StageFrame(frame_, frame_size_);
+	ApplyFrame(frame_, frame_size_);
+
+	// Read back in the same burst
+	if(verify_)
+		return VerifyMemory(LMX2492_HOP_ADDRESS, &image_[LMX2492_HOP_ADDRESS], LMX2492_HOP_SIZE);
+
+	return true;
+}
+
+bool LMX2492Driver::HopAsync(const LMX2492HopTable *table, size_t index, SpiCallback callback, void *context)
+{
+	assert(table != NULL);
+
+	// Transmit buffer still in use or recording
+	if (SpiBusy() || (record_ != NULL)) return false;
+
+	// Frame is already encoded
+	memcpy(frame_, table->Entry(index)->frame, LMX2492_HOP_FRAME_SIZE);
+	frame_size_ = LMX2492_HOP_FRAME_SIZE;
+
+	if(!TransmitFrameAsync(callback, context)) return false;
+
+	StageFrame(frame_, frame_size_);
 
 	return true;
 }
 
+void LMX2492Driver::AsyncComplete(void *context, bool success)
+{
+	LMX2492Driver *self = (LMX2492Driver*)context;
+
+#ifdef LMX2492_TRACE
+	LMX2492Trace *trace_ = self->trace_;
+	(void)LMX2492_TRACE_END(self->trace_async_, success);
+#endif
+
+	if(success)
+		self->ApplyFrame(self->frame_, self->frame_size_);
+
+	if(self->async_callback_ != NULL)
+		self->async_callback_(self->async_context_, success);
+}
+
+void LMX2492Driver::BeginRecord(LMX2492Sequence *sequence)
+{
+	assert(sequence != NULL);
+
+	record_ = sequence;
+	record_overflow_ = false;
+}
+
+bool LMX2492Driver::EndRecord()
+{
+	record_ = NULL;
+
+	return !record_overflow_;
+}
+
+bool LMX2492Driver::Replay(const LMX2492Sequence *sequence, SpiCallback callback, void *context)
+{
+	if(!StartReplay(sequence, callback, context)) return false;
+
+	// Register image is updated here, the complete interrupt updates the shadow only
+	StageSequence(sequence);
+
+	return true;
+}
+
+bool LMX2492Driver::StartReplay(const LMX2492Sequence *sequence, SpiCallback callback, void *context)
+{
+	assert(sequence != NULL);
+
+	// Transmit buffer still in use or recording
+	if (SpiBusy() || (record_ != NULL)) return false;
+
+	replay_ = sequence;
+	async_callback_ = callback;
+	async_context_ = context;
+
+	// Address of the first frame, bytes of all frames without their length bytes
+	LMX2492_TRACE_BEGIN(rec, LMX2492_TRACE_REPLAY, (sequence->Size() > 0) ? frame_address(sequence->Data() + 1, sequence->Data()[0]) : 0,
+			sequence->Size() - sequence->Count());
+
+	// Configure bus
+	if (!SpiConfig(SPI_DATASIZE_8BIT, SPI_POLARITY_LOW, SPI_PHASE_1EDGE)) return LMX2492_TRACE_END(rec, false);
+	// Acquire the bus, the peripheral is reinitialized if configured for another device
+	if (!SpiAcquire()) return LMX2492_TRACE_END(rec, false);
+	LMX2492_TRACE_MARK(rec, configured);
+	// Begin SPI transfer
+	if (!SpiSelect()) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
+	LMX2492_TRACE_MARK(rec, selected);
+
+#ifdef LMX2492_TRACE
+	trace_async_ = rec;
+#endif
+
+	// Start DMA, CS is toggled between the frames in the complete interrupt
+	if (!SpiWriteChainAsync(sequence->Data(), sequence->Size(), &LMX2492Driver::ReplayComplete, this))
+	{
+		SpiEnd();
+		return LMX2492_TRACE_END(rec, false);
+	}
+
+	return true;
+}
+
+bool LMX2492Driver::WriteSequence(const LMX2492Sequence *sequence)
+{
+	assert(sequence != NULL);
+
+	// Transmit buffer still in use or recording
+	if (SpiBusy() || (record_ != NULL)) return false;
+
+	const uint8_t *frame = sequence->Data();
+	const uint8_t *end = frame + sequence->Size();
+
+	// Configure bus
+	if (!SpiConfig(SPI_DATASIZE_8BIT, SPI_POLARITY_LOW, SPI_PHASE_1EDGE)) return false;
+
+	for(; frame < end; frame += frame[0] + 1)
+	{
+		LMX2492_TRACE_BEGIN(rec, LMX2492_TRACE_WRITE, frame_address(frame + 1, frame[0]), frame[0]);
+
+		// Frames are transmitted as they are
+		if (!SpiAcquire()) return LMX2492_TRACE_END(rec, false);
+		LMX2492_TRACE_MARK(rec, configured);
+		if (!SpiSelect()) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
+		LMX2492_TRACE_MARK(rec, selected);
+		if (!SpiWrite(const_cast<uint8_t*>(frame + 1), frame[0])) { SpiEnd(); return LMX2492_TRACE_END(rec, false); }
+		if (!SpiEnd()) return LMX2492_TRACE_END(rec, false);
+		(void)LMX2492_TRACE_END(rec, true);
+
+		StageFrame(frame + 1, frame[0]);
+		ApplyFrame(frame + 1, frame[0]);
+	}
+
+	return true;
+}
+
+void LMX2492Driver::ReplayComplete(void *context, bool success)
+{
+	LMX2492Driver *self = (LMX2492Driver*)context;
+
+#ifdef LMX2492_TRACE
+	LMX2492Trace *trace_ = self->trace_;
+	(void)LMX2492_TRACE_END(self->trace_async_, success);
+#endif
+
+	if(success)
+	{
+		// Apply all frames to the shadow
+		const uint8_t *frame = self->replay_->Data();
+		const uint8_t *end = frame + self->replay_->Size();
+
+		for(; frame < end; frame += frame[0] + 1)
+			self->ApplyFrame(frame + 1, frame[0]);
+	}
+	else
+	{
+		// Unknown how far the sequence got
+		self->InvalidateShadow();
+	}
+
+	self->replay_ = NULL;
+
+	if(self->async_callback_ != NULL)
+		self->async_callback_(self->async_context_, success);
+}
+
+size_t LMX2492Driver::EncodeFrame(uint16_t address, const uint8_t *data, size_t size, uint8_t *frame)
+{
+	// assert parameters
+	assert(data != NULL);
+	assert(frame != NULL);
+	assert(size > 0);
+	assert(address + size <= LMX2492_REGISTER_COUNT); // Max PLL address space
+
+	// Point to last byte of data
+	data += (size - 1);
+	address += (size - 1);
+
+	// Transmit address (1 bit R/~W, 15 bit address)
+	frame[0] = (uint8_t)((address >> 8) & 0x7F);
+	frame[1] = (uint8_t)(address & 0xFF);
+
+	// Data in reverse byte order
+	for(size_t i = 0; i < size; ++i)
+		frame[LMX2492_FRAME_HEADER_SIZE + i] = *data--;
+
+	return size + LMX2492_FRAME_HEADER_SIZE;
+}
+
+void LMX2492Driver::StageFrame(const uint8_t *frame, size_t size)
+{
+	assert(size > LMX2492_FRAME_HEADER_SIZE);
+
+	// Address of the first data byte in the frame
+	uint16_t address = (uint16_t)(((frame[0] & 0x7F) << 8) | frame[1]);
+
+	InvalidateRampBanks(address + 1 - (size - LMX2492_FRAME_HEADER_SIZE), size - LMX2492_FRAME_HEADER_SIZE);
+
+	for(size_t i = LMX2492_FRAME_HEADER_SIZE; i < size; ++i, --address)
+	{
+		// The reset value must not end up in the register image
+		if((address == LMX2492_SWRST_ADDR) && (frame[i] & LMX2492_SWRST_RESET))
+			continue;
+
+		image_[address] = frame[i];
+		mask_set(image_mask_, address);
+	}
+}
+
+void LMX2492Driver::InvalidateRampBanks(uint16_t address, size_t size)
+{
+	for(uint8_t bank = 0; bank < 2; ++bank)
+	{
+		uint16_t first = LMX2492_RAMP_ADDRESS(bank * LMX2492_RAMP_BANK_SIZE);
+		uint16_t last = LMX2492_RAMP_LAST_ADDRESS(bank * LMX2492_RAMP_BANK_SIZE + LMX2492_RAMP_BANK_SIZE - 1);
+
+		if((address <= last) && (address + size > first))
+			bank_size_[bank] = 0;
+	}
+}
+
+void LMX2492Driver::StageSequence(const LMX2492Sequence *sequence)
+{
+	const uint8_t *frame = sequence->Data();
+	const uint8_t *end = frame + sequence->Size();
+
+	for(; frame < end; frame += frame[0] + 1)
+		StageFrame(frame + 1, frame[0]);
+}
+
+void LMX2492Driver::ApplyFrame(const uint8_t *frame, size_t size)
+{
+	assert(size > LMX2492_FRAME_HEADER_SIZE);
+
+	// Address of the first data byte in the frame
+	uint16_t address = (uint16_t)(((frame[0] & 0x7F) << 8) | frame[1]);
+
+	for(size_t i = LMX2492_FRAME_HEADER_SIZE; i < size; ++i, --address)
+	{
+		// Soft reset, all registers back at POR values
+		if((address == LMX2492_SWRST_ADDR) && (frame[i] & LMX2492_SWRST_RESET))
+		{
+			InvalidateShadow();
+			continue;
+		}
+
+		shadow_[address] = frame[i];
+		mask_set(shadow_mask_, address);
+	}
+}
+
 void LMX2492Driver::SimpleConfig(LMX2492_Config_TypeDef* config, uint32_t N, uint8_t CPPOL, uint8_t CPG, uint32_t FRAC_NUM, uint32_t FRAC_DEN, uint16_t R, uint8_t OSC_2X)
 {
 	// assert parameters
@@ -108,42 +922,19 @@ void LMX2492Driver::SimpleConfig(LMX2492_Config_TypeDef* config, uint32_t N, uin
 	assert(R <= 0xFFFF);
 	assert(OSC_2X <= 0x1);
 
-	// Reset struct
-	memset(config, 0, sizeof(LMX2492_Config_TypeDef));
-
-	// Fill struct
-	config->PLL_N_7_0 = N & 0xFF;
-	config->PLL_N_15_8 = (N >> 8) & 0xFF;
-	config->PLL_N_17_16 = (N >> 16) & 0x03;
-
-	config->CPPOL = CPPOL;
-	config->CPG = CPG;
-
-	config->PLL_R_7_0 = R & 0xFF;
-	config->PLL_R_15_8 = (R >> 8) & 0xFF;
-
-	config->OSC_2X = OSC_2X;
-
-	config->FRAC_NUM_7_0 = FRAC_NUM & 0xFF;
-	config->FRAC_NUM_15_8 = (FRAC_NUM >> 8) & 0xFF;
-	config->FRAC_NUM_23_16 = (FRAC_NUM >> 16) & 0xFF;
-
-	config->FRAC_DEN_7_0 = FRAC_DEN & 0xFF;
-	config->FRAC_DEN_15_8 = (FRAC_DEN >> 8) & 0xFF;
-	config->FRAC_DEN_23_16 = (FRAC_DEN >> 16) & 0xFF;
-
-	//if(FRAC_NUM != 0)
-	//{
-		config->FRAC_ORDER = LMX2492_FRAC_ORDER_2;
-	//}
+	uint8_t *data = (uint8_t*)config;
 
 	// POR values
-	config->PFD_DLY = 1;
-	config->DLD_PASS_CNT = 0x20;
-	config->DLD_ERR_CNTR = 0x04;
-	config->FRAC_DITHER = LMX2492_FRAC_DITHER_DISABLED;
-	config->CMP_THR_HIGH = 0x32;
-	config->CMP_THR_LOW = 0x0A;
+	memcpy(data, &LMX2492_RESET_IMAGE.data[LMX2492_CONFIG_ADDRESS], sizeof(LMX2492_Config_TypeDef));
+
+	LMX2492FieldSet<LMX2492_FIELD_PLL_N>(data, LMX2492_CONFIG_ADDRESS, N);
+	LMX2492FieldSet<LMX2492_FIELD_FRAC_ORDER>(data, LMX2492_CONFIG_ADDRESS, LMX2492_FRAC_ORDER_2);
+	LMX2492FieldSet<LMX2492_FIELD_FRAC_NUM>(data, LMX2492_CONFIG_ADDRESS, FRAC_NUM);
+	LMX2492FieldSet<LMX2492_FIELD_FRAC_DEN>(data, LMX2492_CONFIG_ADDRESS, FRAC_DEN);
+	LMX2492FieldSet<LMX2492_FIELD_PLL_R>(data, LMX2492_CONFIG_ADDRESS, R);
+	LMX2492FieldSet<LMX2492_FIELD_OSC_2X>(data, LMX2492_CONFIG_ADDRESS, OSC_2X);
+	LMX2492FieldSet<LMX2492_FIELD_CPG>(data, LMX2492_CONFIG_ADDRESS, CPG);
+	LMX2492FieldSet<LMX2492_FIELD_CPPOL>(data, LMX2492_CONFIG_ADDRESS, CPPOL);
 }
 
 void LMX2492Driver::SimpleConfig(LMX2492_Config_TypeDef* config, float fout, float fref, uint8_t CPPOL, uint8_t CPG, uint16_t R, uint8_t OSC_2X)
@@ -170,12 +961,47 @@ void LMX2492Driver::DividerFromFrequency(float fout, float fref, uint32_t& N, ui
 
 	N = (uint32_t)Ndiv;
 
-#ifdef USE_RICHARDS_FRACTION
-	richards_fraction(Ndiv - N, FRAC_NUM, FRAC_DEN);
-#else
-	FRAC_DEN = 0xFFFFFF;
-	FRAC_NUM = (uint32_t)(FRAC_DEN * (Ndiv - N))
-#endif
+	// Fraction in 2^-24 steps (float resolution), simplest fraction within one step
+	uint32_t frac = (uint32_t)((Ndiv - N) * 16777216.0f + 0.5f);
+
+	if(frac >= (1UL << 24))
+	{
+		++N;
+		frac = 0;
+	}
+
+	best_rational(frac, 1UL << 24, BEST_RATIONAL_MAX_DEN, FRAC_NUM, FRAC_DEN, 1);
+}
+
+int64_t LMX2492Driver::SimpleConfigHz(LMX2492_Config_TypeDef* config, uint64_t fout, uint32_t fref, uint8_t CPPOL, uint8_t CPG, uint16_t R, uint8_t OSC_2X)
+{
+	uint32_t N, FRAC_NUM, FRAC_DEN;
+
+	// Calculate dividers
+	int64_t err = LMX2492Driver::DividerFromFrequencyHz(fout, fref, N, FRAC_NUM, FRAC_DEN, R, OSC_2X);
+
+	// Configure
+	LMX2492Driver::SimpleConfig(config, N, CPPOL, CPG, FRAC_NUM, FRAC_DEN, R, OSC_2X);
+
+	return err;
+}
+
+int64_t LMX2492Driver::DividerFromFrequencyHz(uint64_t fout, uint32_t fref, uint32_t& N, uint32_t& FRAC_NUM, uint32_t& FRAC_DEN, uint16_t R, uint8_t OSC_2X)
+{
+	// Ndiv = fout * R / D with D = fref * (OSC_2X + 1)
+	uint64_t D = (uint64_t)fref * (OSC_2X + 1);
+	uint64_t rem = (fout * R) % D;
+
+	LMX2492Plan::DividerFromFrequency(fout, fref, N, FRAC_NUM, FRAC_DEN, R, OSC_2X);
+
+	// Error of the fraction: NUM / DEN - rem / D = (NUM * D - rem * DEN) / (D * DEN),
+	// scaled by fPFD = D / R. Both products stay below 2^56.
+	int64_t diff = (int64_t)(FRAC_NUM * D) - (int64_t)(rem * FRAC_DEN);
+	int64_t div = (int64_t)FRAC_DEN * R;
+
+	// mHz, rounded to nearest
+	diff *= 1000;
+	return (diff >= 0) ? (diff + div / 2) / div : (diff - div / 2) / div;
 }
 
 // Generate simple PLL GPIO configuration
@@ -193,27 +1019,22 @@ void LMX2492Driver::SimpleGPIOConfig(LMX2492_GPIO_Config_TypeDef* gpio_config, u
 	assert(MUXout_MUX <= 38);
 	assert(MUXout_PIN <= 7);
 
-	// Reset struct
-	memset(gpio_config, 0, sizeof(LMX2492_GPIO_Config_TypeDef));
-	gpio_config->_0x23b2_0 = 1;
-	gpio_config->_0x23b6 = 1;
+	uint8_t *data = (uint8_t*)gpio_config;
 
+	// POR values, reserved bits set
+	memcpy(data, &LMX2492_RESET_IMAGE.data[LMX2492_GPIO_CONFIG_ADDRESS], sizeof(LMX2492_GPIO_Config_TypeDef));
 
-	gpio_config->TRIG1_MUX_5 = (TRIG1_MUX >> 5) & 0x01;
-	gpio_config->TRIG1_MUX_4_0 = TRIG1_MUX & 0x1F;
-	gpio_config->TRIG1_PIN = TRIG1_PIN;
+	LMX2492FieldSet<LMX2492_FIELD_TRIG1_MUX>(data, LMX2492_GPIO_CONFIG_ADDRESS, TRIG1_MUX);
+	LMX2492FieldSet<LMX2492_FIELD_TRIG1_PIN>(data, LMX2492_GPIO_CONFIG_ADDRESS, TRIG1_PIN);
 
-	gpio_config->TRIG2_MUX_5 = (TRIG2_MUX >> 5) & 0x01;
-	gpio_config->TRIG2_MUX_4_0 = TRIG2_MUX & 0x1F;
-	gpio_config->TRIG2_PIN = TRIG2_PIN;
+	LMX2492FieldSet<LMX2492_FIELD_TRIG2_MUX>(data, LMX2492_GPIO_CONFIG_ADDRESS, TRIG2_MUX);
+	LMX2492FieldSet<LMX2492_FIELD_TRIG2_PIN>(data, LMX2492_GPIO_CONFIG_ADDRESS, TRIG2_PIN);
 
-	gpio_config->MOD_MUX_5 = (MOD_MUX >> 5) & 0x01;
-	gpio_config->MOD_MUX_4_0 = MOD_MUX & 0x1F;
-	gpio_config->MOD_PIN = MOD_PIN;
+	LMX2492FieldSet<LMX2492_FIELD_MOD_MUX>(data, LMX2492_GPIO_CONFIG_ADDRESS, MOD_MUX);
+	LMX2492FieldSet<LMX2492_FIELD_MOD_PIN>(data, LMX2492_GPIO_CONFIG_ADDRESS, MOD_PIN);
 
-	gpio_config->MUXout_MUX_5 = (MUXout_MUX >> 5) & 0x01;
-	gpio_config->MUXout_MUX_4_0 = MUXout_MUX & 0x1F;
-	gpio_config->MUXout_PIN = MUXout_PIN;
+	LMX2492FieldSet<LMX2492_FIELD_MUXout_MUX>(data, LMX2492_GPIO_CONFIG_ADDRESS, MUXout_MUX);
+	LMX2492FieldSet<LMX2492_FIELD_MUXout_PIN>(data, LMX2492_GPIO_CONFIG_ADDRESS, MUXout_PIN);
 }
 
 void LMX2492Driver::SimpleRampConfig(LMX2492_Ramp_Config_TypeDef* ramp_config, uint8_t RAMP_EN, uint8_t RAMP_CLK, uint8_t RAMP_TRIGA, uint16_t RAMP_COUNT)
@@ -223,29 +1044,24 @@ void LMX2492Driver::SimpleRampConfig(LMX2492_Ramp_Config_TypeDef* ramp_config, u
 	assert(RAMP_TRIGA <= 15);
 	assert(RAMP_COUNT <= 0x1FFF);
 
-	// Reset struct
-	memset(ramp_config, 0, sizeof(LMX2492_Ramp_Config_TypeDef));
+	uint8_t *data = (uint8_t*)ramp_config;
 
-	ramp_config->RAMP_EN = RAMP_EN;
-	ramp_config->RAMP_CLK = RAMP_CLK;
-	ramp_config->RAMP_TRIG_A = RAMP_TRIGA;
+	// POR values
+	memcpy(data, &LMX2492_RESET_IMAGE.data[LMX2492_RAMP_CONFIG_ADDRESS], sizeof(LMX2492_Ramp_Config_TypeDef));
 
-	ramp_config->RAMP_COUNT_7_0 = RAMP_COUNT & 0xFF;
-	ramp_config->RAMP_COUNT_12_8 = (RAMP_COUNT >> 8) & 0x1F;
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_EN>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_EN);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_CLK>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_CLK);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_TRIG_A>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_TRIGA);
 
-	if(RAMP_COUNT != 0)
-		ramp_config->RAMP_AUTO = 1;
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_COUNT>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_COUNT);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_AUTO>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_COUNT != 0);
 
-	// Max. high limit (twos complement 33 bit)
-	ramp_config->RAMP_LIMIT_HIGH_7_0 = 0xFF;
-	ramp_config->RAMP_LIMIT_HIGH_15_8 = 0xFF;
-	ramp_config->RAMP_LIMIT_HIGH_23_16 = 0xFF;
-	ramp_config->RAMP_LIMIT_HIGH_31_24 = 0xFF;
-	// Min. low limit (twos complement 33 bit)
-	ramp_config->RAMP_LIMIT_LOW_32 = 0x1;
+	// Max. high limit, min. low limit (twos complement 33 bit)
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_LIMIT_HIGH>(data, LMX2492_RAMP_CONFIG_ADDRESS, 0x0FFFFFFFFULL);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_LIMIT_LOW>(data, LMX2492_RAMP_CONFIG_ADDRESS, 0x100000000ULL);
 }
 
-// TODO: finc as output parameter for optimum ramp accuracy to set the increment timer accordingly. For now it remains an input parameter
+// finc remains an input parameter, LMX2492RampOptimizer searches LEN, INC and the ramp clock jointly
 void LMX2492Driver::RampFromFrequency(float df, float fref, float duration, uint32_t& INC, uint16_t& LEN, float finc, uint16_t R, uint8_t OSC_2X)
 {
 	assert(OSC_2X <= 0x1);
@@ -276,6 +1092,205 @@ void LMX2492Driver::RampFromFrequency(float df, float fref, float duration, uint
 	INC = (uint32_t)(incf + 0.5f);
 }
 
+int64_t LMX2492Driver::RampFromFrequencyHz(int64_t df, uint32_t fref, uint32_t duration, uint32_t& INC, uint16_t& LEN, uint32_t finc, uint16_t R, uint8_t OSC_2X)
+{
+	LMX2492Plan::RampFromFrequency(df, fref, duration, INC, LEN, finc, R, OSC_2X);
+
+	return RampDeltaHz(INC, LEN, fref, R, OSC_2X) - df * 1000;
+}
+
+int64_t LMX2492Driver::RampDeltaHz(uint32_t INC, uint32_t LEN, uint32_t fref, uint16_t R, uint8_t OSC_2X)
+{
+	assert(INC <= 0x3FFFFFFF);
+	assert(R > 0);
+
+	// Delta = INC * LEN * D / (R * 2^24) with D = fref * (OSC_2X + 1)
+	uint64_t D = (uint64_t)fref * (OSC_2X + 1);
+	uint32_t inc = (INC & 0x20000000) ? (0x40000000 - INC) : INC;
+	uint64_t P = (uint64_t)inc * LEN;
+
+	uint64_t delta = frac24_mhz(P, D, R);
+
+	return (INC & 0x20000000) ? -(int64_t)delta : (int64_t)delta;
+}
+
+int64_t LMX2492Driver::FskFromFrequencyHz(int64_t deviation, uint32_t fref, uint64_t& FSK_DEV, uint16_t R, uint8_t OSC_2X)
+{
+	return RampOffsetFromFrequencyHz(deviation, fref, FSK_DEV, R, OSC_2X);
+}
+
+void LMX2492Driver::SimpleFskConfig(LMX2492_Ramp_Config_TypeDef* ramp_config, LMX2492_GPIO_Config_TypeDef* gpio_config, uint64_t FSK_DEV, uint8_t pin, uint8_t FSK_TRIG)
+{
+	assert(ramp_config != NULL);
+	assert(gpio_config != NULL);
+	assert(FSK_DEV <= 0x1FFFFFFFFULL);
+	assert(pin <= LMX2492_FSK_PIN_MOD);
+	assert((FSK_TRIG >= LMX2492_FSK_TRIG_A) && (FSK_TRIG <= LMX2492_FSK_TRIG_C));
+
+	uint8_t *ramp_data = (uint8_t*)ramp_config;
+	uint8_t *gpio_data = (uint8_t*)gpio_config;
+
+	LMX2492FieldSet<LMX2492_FIELD_FSK_DEV>(ramp_data, LMX2492_RAMP_CONFIG_ADDRESS, FSK_DEV);
+	LMX2492FieldSet<LMX2492_FIELD_FSK_TRIG>(ramp_data, LMX2492_RAMP_CONFIG_ADDRESS, FSK_TRIG);
+
+	// Pin as input, its rising edge source of the ramp trigger
+	uint8_t source = LMX2492_RAMP_TRIG_TRIG1_RISING;
+
+	switch(pin)
+	{
+	case LMX2492_FSK_PIN_TRIG1:
+		LMX2492FieldSet<LMX2492_FIELD_TRIG1_MUX>(gpio_data, LMX2492_GPIO_CONFIG_ADDRESS, LMX2492_MUX_IN_TRIG1);
+		LMX2492FieldSet<LMX2492_FIELD_TRIG1_PIN>(gpio_data, LMX2492_GPIO_CONFIG_ADDRESS, LMX2492_PIN_INPUT);
+		source = LMX2492_RAMP_TRIG_TRIG1_RISING;
+		break;
+	case LMX2492_FSK_PIN_TRIG2:
+		LMX2492FieldSet<LMX2492_FIELD_TRIG2_MUX>(gpio_data, LMX2492_GPIO_CONFIG_ADDRESS, LMX2492_MUX_IN_TRIG2);
+		LMX2492FieldSet<LMX2492_FIELD_TRIG2_PIN>(gpio_data, LMX2492_GPIO_CONFIG_ADDRESS, LMX2492_PIN_INPUT);
+		source = LMX2492_RAMP_TRIG_TRIG2_RISING;
+		break;
+	default:
+		LMX2492FieldSet<LMX2492_FIELD_MOD_MUX>(gpio_data, LMX2492_GPIO_CONFIG_ADDRESS, LMX2492_MUX_IN_MOD);
+		LMX2492FieldSet<LMX2492_FIELD_MOD_PIN>(gpio_data, LMX2492_GPIO_CONFIG_ADDRESS, LMX2492_PIN_INPUT);
+		source = LMX2492_RAMP_TRIG_MOD_RISING;
+		break;
+	}
+
+	switch(FSK_TRIG)
+	{
+	case LMX2492_FSK_TRIG_A:
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_TRIG_A>(ramp_data, LMX2492_RAMP_CONFIG_ADDRESS, source);
+		break;
+	case LMX2492_FSK_TRIG_B:
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_TRIG_B>(ramp_data, LMX2492_RAMP_CONFIG_ADDRESS, source);
+		break;
+	default:
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_TRIG_C>(ramp_data, LMX2492_RAMP_CONFIG_ADDRESS, source);
+		break;
+	}
+}
+
+uint32_t LMX2492Driver::FskMaxSymbolRate(uint32_t fref, uint16_t R, uint8_t OSC_2X)
+{
+	assert(R > 0);
+	assert(OSC_2X <= 0x1);
+
+	// fPFD / LMX2492_FSK_PFD_CYCLES
+	return (uint32_t)((uint64_t)fref * (OSC_2X + 1) / ((uint64_t)R * LMX2492_FSK_PFD_CYCLES));
+}
+
+uint32_t LMX2492Driver::FskMaxSymbolRate(uint32_t fref) const
+{
+	uint16_t R = (uint16_t)StagedField<LMX2492_FIELD_PLL_R>();
+
+	// PLL_R not staged yet
+	if(R == 0) R = 1;
+
+	return FskMaxSymbolRate(fref, R, (uint8_t)StagedField<LMX2492_FIELD_OSC_2X>());
+}
+
+int64_t LMX2492Driver::RampOffsetFromFrequencyHz(int64_t offset, uint32_t fref, uint64_t& value, uint16_t R, uint8_t OSC_2X)
+{
+	assert(fref > 0);
+	assert(R > 0);
+	assert(OSC_2X <= 0x1);
+
+	// value = offset / fPFD * 2^24 with fPFD = D / R
+	uint64_t D = (uint64_t)fref * (OSC_2X + 1);
+	uint64_t mag = (uint64_t)((offset < 0) ? -offset : offset);
+	uint64_t frac = LMX2492Plan::ScaleFrac24(mag * R, D);
+
+	// Check if value fits in 33 bit two's complement register
+	assert(frac <= ((offset < 0) ? 0x100000000ULL : 0xFFFFFFFFULL));
+
+	value = (offset < 0) ? ((0x200000000ULL - frac) & 0x1FFFFFFFFULL) : frac;
+
+	int64_t achieved = (int64_t)frac24_mhz(frac, D, R);
+
+	return ((offset < 0) ? -achieved : achieved) - offset * 1000;
+}
+
+void LMX2492Driver::SimpleRampComparator(LMX2492_Ramp_Config_TypeDef* ramp_config, uint8_t comparator, uint64_t RAMP_CMP, uint8_t RAMP_CMP_EN, uint8_t trigger)
+{
+	assert(ramp_config != NULL);
+	assert(comparator <= LMX2492_CMP1);
+	assert(RAMP_CMP <= 0x1FFFFFFFFULL);
+	assert(trigger <= LMX2492_RAMPx_NEXT_TRIG_TRIG_C);
+
+	uint8_t *data = (uint8_t*)ramp_config;
+	uint8_t source = LMX2492_RAMP_TRIG_CMP0;
+
+	if(comparator == LMX2492_CMP0)
+	{
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_CMP0>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_CMP);
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_CMP0_EN>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_CMP_EN);
+	}
+	else
+	{
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_CMP1>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_CMP);
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_CMP1_EN>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_CMP_EN);
+		source = LMX2492_RAMP_TRIG_CMP1;
+	}
+
+	switch(trigger)
+	{
+	case LMX2492_RAMPx_NEXT_TRIG_TRIG_A:
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_TRIG_A>(data, LMX2492_RAMP_CONFIG_ADDRESS, source);
+		break;
+	case LMX2492_RAMPx_NEXT_TRIG_TRIG_B:
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_TRIG_B>(data, LMX2492_RAMP_CONFIG_ADDRESS, source);
+		break;
+	case LMX2492_RAMPx_NEXT_TRIG_TRIG_C:
+		LMX2492FieldSet<LMX2492_FIELD_RAMP_TRIG_C>(data, LMX2492_RAMP_CONFIG_ADDRESS, source);
+		break;
+	default:
+		break;
+	}
+}
+
+void LMX2492Driver::SimpleRampLimits(LMX2492_Ramp_Config_TypeDef* ramp_config, uint64_t RAMP_LIMIT_LOW, uint64_t RAMP_LIMIT_HIGH)
+{
+	assert(ramp_config != NULL);
+	assert(RAMP_LIMIT_LOW <= 0x1FFFFFFFFULL);
+	assert(RAMP_LIMIT_HIGH <= 0x1FFFFFFFFULL);
+	assert(sign_extend33(RAMP_LIMIT_LOW) <= sign_extend33(RAMP_LIMIT_HIGH));
+
+	uint8_t *data = (uint8_t*)ramp_config;
+
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_LIMIT_LOW>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_LIMIT_LOW);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_LIMIT_HIGH>(data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_LIMIT_HIGH);
+}
+
+void LMX2492Driver::SimpleComparatorOutput(LMX2492_GPIO_Config_TypeDef* gpio_config, uint8_t pin, uint8_t source, uint8_t drive)
+{
+	assert(gpio_config != NULL);
+	assert(pin <= LMX2492_CMP_PIN_MUXOUT);
+	assert((source == LMX2492_MUX_OUT_CMP0) || (source == LMX2492_MUX_OUT_CMP1) || (source == LMX2492_MUX_OUT_CMP0RAMP)
+			|| (source == LMX2492_MUX_OUT_CMP1RAMP) || (source == LMX2492_MUX_OUT_RAMPLIMEXC));
+	assert((drive != LMX2492_PIN_TRISTATE) && (drive < LMX2492_PIN_INPUT));
+
+	uint8_t *data = (uint8_t*)gpio_config;
+
+	switch(pin)
+	{
+	case LMX2492_CMP_PIN_TRIG1:
+		LMX2492FieldSet<LMX2492_FIELD_TRIG1_MUX>(data, LMX2492_GPIO_CONFIG_ADDRESS, source);
+		LMX2492FieldSet<LMX2492_FIELD_TRIG1_PIN>(data, LMX2492_GPIO_CONFIG_ADDRESS, drive);
+		break;
+	case LMX2492_CMP_PIN_TRIG2:
+		LMX2492FieldSet<LMX2492_FIELD_TRIG2_MUX>(data, LMX2492_GPIO_CONFIG_ADDRESS, source);
+		LMX2492FieldSet<LMX2492_FIELD_TRIG2_PIN>(data, LMX2492_GPIO_CONFIG_ADDRESS, drive);
+		break;
+	case LMX2492_CMP_PIN_MOD:
+		LMX2492FieldSet<LMX2492_FIELD_MOD_MUX>(data, LMX2492_GPIO_CONFIG_ADDRESS, source);
+		LMX2492FieldSet<LMX2492_FIELD_MOD_PIN>(data, LMX2492_GPIO_CONFIG_ADDRESS, drive);
+		break;
+	default:
+		LMX2492FieldSet<LMX2492_FIELD_MUXout_MUX>(data, LMX2492_GPIO_CONFIG_ADDRESS, source);
+		LMX2492FieldSet<LMX2492_FIELD_MUXout_PIN>(data, LMX2492_GPIO_CONFIG_ADDRESS, drive);
+		break;
+	}
+}
+
 void LMX2492Driver::SimpleRamp(LMX2492_Ramp_TypeDef* ramp, uint32_t RAMP_INC, uint16_t RAMP_LEN, uint8_t RAMP_NEXT, uint8_t RAMP_RST, uint8_t RAMP_NEXT_TRIG, uint8_t RAMP_DLY)
 {
 	assert(RAMP_INC <= 0x3FFFFFFF);
@@ -284,21 +1299,18 @@ void LMX2492Driver::SimpleRamp(LMX2492_Ramp_TypeDef* ramp, uint32_t RAMP_INC, ui
 	assert(RAMP_NEXT_TRIG <= 4);
 	assert(RAMP_DLY <= 1);
 
-	// Reset struct
-	memset(ramp, 0, sizeof(LMX2492_Ramp_TypeDef));
+	uint8_t *data = (uint8_t*)ramp;
 
-	ramp->RAMPx_INC_29_24 = (RAMP_INC >> 24) & 0x3F;
-	ramp->RAMPx_INC_23_16 = (RAMP_INC >> 16) & 0xFF;
-	ramp->RAMPx_INC_15_8 = (RAMP_INC >> 8) & 0xFF;
-	ramp->RAMPx_INC_7_0 = RAMP_INC & 0xFF;
+	// Encoded as slot 0, all slots share the layout
+	memset(data, 0, sizeof(LMX2492_Ramp_TypeDef));
 
-	ramp->RAMPx_LEN_15_8 = (RAMP_LEN >> 8) & 0xFF;
-	ramp->RAMPx_LEN_7_0 = RAMP_LEN & 0xFF;
+	LMX2492FieldSet<LMX2492_FIELD_RAMP0_INC>(data, LMX2492_RAMP_ADDRESS(0), RAMP_INC);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP0_DLY>(data, LMX2492_RAMP_ADDRESS(0), RAMP_DLY);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP0_LEN>(data, LMX2492_RAMP_ADDRESS(0), RAMP_LEN);
 
-	ramp->RAMPx_NEXT = RAMP_NEXT;
-	ramp->RAMPx_RST = RAMP_RST;
-	ramp->RAMPx_NEXT_TRIG = RAMP_NEXT_TRIG;
-	ramp->RAMPx_DLY = RAMP_DLY;
+	LMX2492FieldSet<LMX2492_FIELD_RAMP0_RST>(data, LMX2492_RAMP_ADDRESS(0), RAMP_RST);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(data, LMX2492_RAMP_ADDRESS(0), RAMP_NEXT_TRIG);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP0_NEXT>(data, LMX2492_RAMP_ADDRESS(0), RAMP_NEXT);
 }
 
 } /* namespace bsp */
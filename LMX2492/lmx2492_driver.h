@@ -9,17 +9,52 @@
 #define LMX2492_DRIVER_H_
 
 #include <lmx2492_regdef.h>
+#include <lmx2492_fields.h>
 #include <spislave.h>
+#include <lmx2492_sequence.h>
+#include <lmx2492_hop_table.h>
+#include <lmx2492_trace.h>
 
-#define USE_RICHARDS_FRACTION
+// Max. number of unchanged bytes between two changed byte ranges that are
+// sent along on Commit() to merge both ranges into a single SPI transfer.
+#define LMX2492_COMMIT_MERGE_GAP	3
+
+// SPI frame: 16 bit header (1 bit R/~W, 15 bit address) followed by data in descending address order
+#define LMX2492_FRAME_HEADER_SIZE	2
+#define LMX2492_FRAME_MAX_SIZE		(LMX2492_FRAME_HEADER_SIZE + LMX2492_REGISTER_COUNT)
+
+// FSK symbol input pins
+#define LMX2492_FSK_PIN_TRIG1		0
+#define LMX2492_FSK_PIN_TRIG2		1
+#define LMX2492_FSK_PIN_MOD			2
+
+// The FSK trigger is sampled once per PFD cycle, a symbol must last at least this many cycles
+#define LMX2492_FSK_PFD_CYCLES		2
+
+// Ramp comparators (RAMP_CMP0, RAMP_CMP1)
+#define LMX2492_CMP0				0
+#define LMX2492_CMP1				1
+
+// Comparator and ramp limit output pins
+#define LMX2492_CMP_PIN_TRIG1		0
+#define LMX2492_CMP_PIN_TRIG2		1
+#define LMX2492_CMP_PIN_MOD			2
+#define LMX2492_CMP_PIN_MUXOUT		3
+
+// Ping-pong ramp banks: slots 0 ... 3 (bank 0) and 4 ... 7 (bank 1)
+#define LMX2492_RAMP_BANK_SIZE		(LMX2492_RAMP_COUNT / 2)
 
 namespace bsp
 {
 
+	class LMX2492Group;
+	class LMX2492Scheduler;
+
 	class LMX2492Driver: public SpiSlave
 	{
 	public:
-		LMX2492Driver(SPI_TypeDef * spi_instance, GPIO_TypeDef * cs_port, uint16_t cs_pin);
+		// max_clock .. max. SPI clock in Hz (0 for the SpiSlave default)
+		LMX2492Driver(SPI_TypeDef * spi_instance, GPIO_TypeDef * cs_port, uint16_t cs_pin, uint32_t max_clock = 0);
 
 		virtual ~LMX2492Driver();
 
@@ -41,6 +76,141 @@ namespace bsp
 		// Write PLL Ramp
 		bool WriteRamp(LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx);
 
+		// Write all eight ramps (0x56 ... 0x8D) in a single transfer, e.g. from LMX2492ChirpCompiler::Ramps()
+		bool WriteRamps(const LMX2492_Ramp_TypeDef* ramps);
+
+		// Write up to LMX2492_RAMP_BANK_SIZE ramps into a ramp bank in a single transfer.
+		// RAMPx_NEXT of the ramps is relative to the bank and relocated. A bank written while
+		// recording is not available to SwitchRampBank().
+		// Write the active bank only while the ramp is disabled. The idle bank may be written while
+		// the ramp is not running in it: after SwitchRampBank() the former active bank keeps running
+		// until the ramp reaches a redirected jump. To detect that, set RAMPx_FLAG in the first ramp
+		// of each bank and route LMX2492_MUX_OUT_FLAG0 / FLAG1 to a pin, or wait for the longest
+		// ramp of the former active bank.
+		bool WriteRampBank(uint8_t bank, const LMX2492_Ramp_TypeDef* ramps, uint8_t count);
+
+		// Redirect the jumps back into the active bank (RAMPx_NEXT <= own slot) to the first slot
+		// of the idle bank. The ramp continues in the idle bank at the next ramp boundary
+		// without a gap, which becomes the active bank. Only the NEXT bytes are written.
+		// Both banks must be written by WriteRampBank(), any other write to their slots (WriteRamps,
+		// Commit, WriteMemory, Replay) invalidates a bank. Returns false while recording, if a bank
+		// is invalid or if the active bank has no jump to redirect.
+		bool SwitchRampBank();
+
+		// Bank the ramp is running in, 0 after construction
+		uint8_t ActiveRampBank() const;
+
+		// Bank to be written next
+		uint8_t IdleRampBank() const;
+
+		// Read PLL registers, requires MUXout configured as LMX2492_MUX_OUT_READBACK
+		// with a push pull or open drain output.
+		bool ReadMemory(uint16_t address, uint8_t* data, size_t size);
+
+		// Read PLL Config
+		bool ReadConfig(LMX2492_Config_TypeDef* config);
+
+		// Read PLL GPIO Config
+		bool ReadGPIOConfig(LMX2492_GPIO_Config_TypeDef* gpio_config);
+
+		// Read PLL Ramp Config
+		bool ReadRampConfig(LMX2492_Ramp_Config_TypeDef* ramp_config);
+
+		// Read PLL Ramp
+		bool ReadRamp(LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx);
+
+		// Read back every blocking write in the same burst and compare it.
+		// A write fails if the device contents differ.
+		void SetVerify(bool verify);
+
+		// Read back all staged registers and compare them with the shadow.
+		// Differing registers are marked for rewrite by the next Commit().
+		// Returns false if a register differs or the read failed.
+		bool VerifyShadow();
+
+		// Start writing data to PLL registers by DMA and return immediately.
+		// The data is copied, the callback is invoked from interrupt context when done.
+		// The register image is updated on start, the shadow on completion.
+		// Returns false if a transfer is still in progress.
+		bool WriteMemoryAsync(uint16_t address, const uint8_t* data, size_t size, SpiCallback callback = NULL, void* context = NULL);
+
+		// Record all following register writes (Write*, Reset, Commit) into the
+		// sequence instead of transmitting them. Asynchronous writes fail while recording.
+		void BeginRecord(LMX2492Sequence* sequence);
+
+		// Stop recording, returns false if the sequence ran out of space
+		bool EndRecord();
+
+		// Start replaying a recorded sequence as one chained DMA transfer and return immediately.
+		// The sequence must stay valid until the callback is invoked from interrupt context.
+		// The register image is updated on start, the shadow on completion.
+		bool Replay(const LMX2492Sequence* sequence, SpiCallback callback = NULL, void* context = NULL);
+
+		// Write a recorded sequence frame by frame with blocking transfers
+		bool WriteSequence(const LMX2492Sequence* sequence);
+
+		// Retune to a precomputed frequency, writes only PLL_N, FRAC_NUM and FRAC_DEN (0x10 ... 0x18).
+		// The other bits of these registers are taken from the config the table was built with.
+		bool Hop(const LMX2492HopTable* table, size_t index);
+
+		// Start a hop by DMA and return immediately, the callback is invoked from interrupt context when done.
+		// Returns false if a transfer is still in progress.
+		bool HopAsync(const LMX2492HopTable* table, size_t index, SpiCallback callback = NULL, void* context = NULL);
+
+		// Stage PLL Config in the register image, written on Commit()
+		void StageConfig(const LMX2492_Config_TypeDef* config);
+
+		// Stage PLL GPIO Config in the register image, written on Commit()
+		void StageGPIOConfig(const LMX2492_GPIO_Config_TypeDef* gpio_config);
+
+		// Stage PLL Ramp Config in the register image, written on Commit()
+		void StageRampConfig(const LMX2492_Ramp_Config_TypeDef* ramp_config);
+
+		// Stage PLL Ramp in the register image, written on Commit()
+		void StageRamp(const LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx);
+
+		// Stage all eight ramps in the register image, written on Commit()
+		void StageRamps(const LMX2492_Ramp_TypeDef* ramps);
+
+		// Stage Power configuration in the register image, written on Commit()
+		void StagePowerConfig(uint8_t power_config);
+
+		// Stage raw bytes in the register image, written on Commit()
+		void StageMemory(uint16_t address, const uint8_t* data, size_t size);
+
+		// Stage a single field (LMX2492_FIELD_*) in the register image, written on Commit().
+		// The other bits of its registers keep the staged value, else the known device contents, else POR.
+		template<uint8_t Field>
+		void StageField(uint64_t value)
+		{
+			PrepareField(Field);
+			LMX2492FieldSet<Field>(image_, 0, value);
+		}
+
+		// Field value in the register image
+		template<uint8_t Field>
+		uint64_t StagedField() const
+		{
+			return LMX2492FieldGet<Field>(image_, 0);
+		}
+
+		// Write all staged bytes that differ from the shadow register image.
+		// Changed ranges are sent in descending address order, ranges separated by
+		// at most LMX2492_COMMIT_MERGE_GAP unchanged bytes are merged into one transfer.
+		// Returns false without changes while an asynchronous transfer is in progress.
+		bool Commit();
+
+		// Forget the known device register contents, the next Commit() rewrites all staged bytes.
+		void InvalidateShadow();
+
+#ifdef LMX2492_TRACE
+		// Log all SPI transactions of this driver to trace (NULL to stop tracing)
+		void SetTrace(LMX2492Trace* trace);
+#endif
+
+		// Encode a write frame for data starting at address, returns the frame size
+		static size_t EncodeFrame(uint16_t address, const uint8_t* data, size_t size, uint8_t* frame);
+
 		// Generate simple PLL configuration with a limited feature set from divider values
 		static void SimpleConfig(LMX2492_Config_TypeDef* config, uint32_t N, uint8_t CPPOL, uint8_t CPG, uint32_t FRAC_NUM, uint32_t FRAC_DEN, uint16_t R, uint8_t OSC_2X);
 
@@ -50,6 +220,14 @@ namespace bsp
 		// Calculate pll divider values from frequencies
 		static void DividerFromFrequency(float fout, float fref, uint32_t& N, uint32_t& FRAC_NUM, uint32_t& FRAC_DEN, uint16_t R = 1, uint8_t OSC_2X = 0);
 
+		// Generate simple PLL configuration from integer frequencies in Hz (exact 64 bit arithmetic)
+		// Returns the achieved output frequency error in mHz.
+		static int64_t SimpleConfigHz(LMX2492_Config_TypeDef* config, uint64_t fout, uint32_t fref, uint8_t CPPOL, uint8_t CPG, uint16_t R, uint8_t OSC_2X);
+
+		// Calculate pll divider values from integer frequencies in Hz (exact 64 bit arithmetic)
+		// Returns the achieved output frequency error in mHz.
+		static int64_t DividerFromFrequencyHz(uint64_t fout, uint32_t fref, uint32_t& N, uint32_t& FRAC_NUM, uint32_t& FRAC_DEN, uint16_t R = 1, uint8_t OSC_2X = 0);
+
 		// Generate simple PLL GPIO configuration
 		static void SimpleGPIOConfig(LMX2492_GPIO_Config_TypeDef* gpio_config,
 				uint8_t TRIG1_MUX = LMX2492_MUX_IN_TRIG1, uint8_t TRIG1_PIN = LMX2492_PIN_TRISTATE,
@@ -69,9 +247,140 @@ namespace bsp
 		// finc .. ramp increment frequency in Hz (set to zero if fPFD is used)
 		static void RampFromFrequency(float df, float fref, float duration, uint32_t& INC, uint16_t& LEN, float finc = 0, uint16_t R = 1, uint8_t OSC_2X = 0);
 
+		// Calculate ramp INC and LEN from integer values (exact 64 bit arithmetic)
+		// df .. Frequency delta of the ramp in Hz, may be negative
+		// duration .. the ramp duration in ns
+		// finc .. ramp increment frequency in Hz (set to zero if fPFD is used)
+		// Returns the achieved frequency delta error in mHz.
+		static int64_t RampFromFrequencyHz(int64_t df, uint32_t fref, uint32_t duration, uint32_t& INC, uint16_t& LEN, uint32_t finc = 0, uint16_t R = 1, uint8_t OSC_2X = 0);
+
+		// Frequency delta in mHz of LEN ramp steps with increment INC (30 bit two's complement).
+		// LEN may exceed 16 bit to sum up ramps with equal increment.
+		static int64_t RampDeltaHz(uint32_t INC, uint32_t LEN, uint32_t fref, uint16_t R = 1, uint8_t OSC_2X = 0);
+
+		// Calculate FSK_DEV (33 bit two's complement) from a frequency deviation in Hz, may be negative.
+		// Returns the achieved deviation error in mHz.
+		static int64_t FskFromFrequencyHz(int64_t deviation, uint32_t fref, uint64_t& FSK_DEV, uint16_t R = 1, uint8_t OSC_2X = 0);
+
+		// Add FSK to a ramp config (see SimpleRampConfig) and a GPIO config (see SimpleGPIOConfig).
+		// pin (LMX2492_FSK_PIN_*) becomes the symbol input, routed to ramp trigger FSK_TRIG (A, B or C).
+		// FSK_DEV is added to the output frequency while the pin is high, symbols are clocked by
+		// pin toggles without SPI writes. The ramp engine must be enabled (RAMP_EN).
+		static void SimpleFskConfig(LMX2492_Ramp_Config_TypeDef* ramp_config, LMX2492_GPIO_Config_TypeDef* gpio_config,
+				uint64_t FSK_DEV, uint8_t pin = LMX2492_FSK_PIN_MOD, uint8_t FSK_TRIG = LMX2492_FSK_TRIG_B);
+
+		// Max. FSK symbol rate in symbols/s for a PFD frequency, the loop filter bandwidth
+		// limits the usable rate further.
+		static uint32_t FskMaxSymbolRate(uint32_t fref, uint16_t R, uint8_t OSC_2X);
+
+		// Max. FSK symbol rate of the staged PLL_R and OSC_2X
+		uint32_t FskMaxSymbolRate(uint32_t fref) const;
+
+		// Calculate a ramp offset (33 bit two's complement, FSK_DEV, RAMP_CMPx and RAMP_LIMIT_x) from a
+		// frequency in Hz relative to the ramp start frequency, may be negative.
+		// Returns the achieved offset error in mHz.
+		static int64_t RampOffsetFromFrequencyHz(int64_t offset, uint32_t fref, uint64_t& value, uint16_t R = 1, uint8_t OSC_2X = 0);
+
+		// Add a comparator (LMX2492_CMP0 or LMX2492_CMP1) to a ramp config (see SimpleRampConfig).
+		// The comparator fires when the ramp offset crosses RAMP_CMP during the ramps enabled in
+		// RAMP_CMP_EN (bit x for ramp x). trigger (LMX2492_RAMPx_NEXT_TRIG_TRIG_A ... C) routes it to
+		// a ramp trigger that ramps may wait for, LMX2492_RAMPx_NEXT_TRIG_NONE leaves the triggers.
+		static void SimpleRampComparator(LMX2492_Ramp_Config_TypeDef* ramp_config, uint8_t comparator, uint64_t RAMP_CMP,
+				uint8_t RAMP_CMP_EN = 0xFF, uint8_t trigger = LMX2492_RAMPx_NEXT_TRIG_NONE);
+
+		// Set the ramp limits of a ramp config (see SimpleRampConfig), the ramp offset is clamped to
+		// RAMP_LIMIT_LOW ... RAMP_LIMIT_HIGH (33 bit two's complement).
+		static void SimpleRampLimits(LMX2492_Ramp_Config_TypeDef* ramp_config, uint64_t RAMP_LIMIT_LOW, uint64_t RAMP_LIMIT_HIGH);
+
+		// Route a comparator or limit flag to a pin of a GPIO config (see SimpleGPIOConfig).
+		// pin .. LMX2492_CMP_PIN_*
+		// source .. LMX2492_MUX_OUT_CMP0, CMP1, CMP0RAMP, CMP1RAMP or RAMPLIMEXC
+		static void SimpleComparatorOutput(LMX2492_GPIO_Config_TypeDef* gpio_config, uint8_t pin, uint8_t source, uint8_t drive = LMX2492_PIN_PUSHPULL);
+
 	private:
-		// Write data to PLL register in reverse order
-		bool WriteMemory(uint16_t last_byte_address, uint8_t *reversed_data, size_t size);
+		// Commits the register images of several devices
+		friend class LMX2492Group;
+		// Replays jobs from the complete interrupt
+		friend class LMX2492Scheduler;
+
+		// Register image staged for the next Commit()
+		uint8_t image_[LMX2492_REGISTER_COUNT];
+		// Register contents last written to the device
+		uint8_t shadow_[LMX2492_REGISTER_COUNT];
+		// Bit masks of image_ bytes holding a value and of shadow_ bytes matching the device
+		uint8_t image_mask_[(LMX2492_REGISTER_COUNT + 7) / 8];
+		uint8_t shadow_mask_[(LMX2492_REGISTER_COUNT + 7) / 8];
+
+		// Transmit buffer, in use until an asynchronous transfer completed
+		uint8_t frame_[LMX2492_FRAME_MAX_SIZE];
+		size_t frame_size_;
+		// User callback of the pending asynchronous transfer
+		SpiCallback async_callback_;
+		void* async_context_;
+		// Sequence being recorded or replayed
+		LMX2492Sequence* record_;
+		bool record_overflow_;
+		const LMX2492Sequence* replay_;
+		// Verify after write
+		bool verify_;
+		// Ping-pong ramp banks
+		uint8_t active_bank_;
+		uint8_t bank_size_[2];
+#ifdef LMX2492_TRACE
+		// Transaction trace and the record of the pending asynchronous transfer
+		LMX2492Trace* trace_;
+		LMX2492_Trace_Record_TypeDef trace_async_;
+#endif
+
+		// Write data to PLL registers and update the shadow register image
+		bool WriteMemory(uint16_t address, const uint8_t *data, size_t size);
+
+		// Update register image and shadow with data written to the device
+		void UpdateShadow(uint16_t address, const uint8_t *data, size_t size);
+
+		// Transmit data to PLL registers in reverse order
+		bool TransmitMemory(uint16_t address, const uint8_t *data, size_t size);
+
+		// Transmit the encoded frame in frame_
+		bool TransmitFrame();
+
+		// Start transmitting the encoded frame in frame_ by DMA
+		bool TransmitFrameAsync(SpiCallback callback, void* context);
+
+		// Compare device contents with data, invalidates the shadow of differing bytes
+		bool VerifyMemory(uint16_t address, const uint8_t *data, size_t size);
+
+		// Update the register image with the contents of a frame, in thread context
+		void StageFrame(const uint8_t *frame, size_t size);
+		void StageSequence(const LMX2492Sequence *sequence);
+
+		// Forget the programs of the ramp banks overlapping the written range
+		void InvalidateRampBanks(uint16_t address, size_t size);
+
+		// Update the shadow with the contents of a transmitted frame, also from the complete interrupt
+		void ApplyFrame(const uint8_t *frame, size_t size);
+
+		// Start a replay without updating the register image, see Replay()
+		bool StartReplay(const LMX2492Sequence* sequence, SpiCallback callback, void* context);
+
+		// Asynchronous transfer complete callbacks
+		static void AsyncComplete(void* context, bool success);
+		static void ReplayComplete(void* context, bool success);
+
+		// Check if a staged byte needs to be written to the device
+		bool IsDirty(uint16_t address) const;
+
+		// Check if the register image holds a value for a byte
+		bool IsStaged(uint16_t address) const;
+
+		// Stage the registers of a field that hold no value yet, see StageField()
+		void PrepareField(uint8_t field);
+
+		// Stage the latch register for rewrite if double buffered PLL registers are dirty
+		void PrepareLatch();
+
+		// Write the dirty staged bytes in first_address ... last_address, see Commit()
+		bool CommitRange(int32_t last_address, int32_t first_address);
 	};
 
 }; /* namespace bsp */
@@ -0,0 +1,60 @@
+/*
+ * lmx2492_fields.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_fields.h>
+
+#include <assert.h>
+
+namespace bsp {
+
+#define LMX2492_FIELD_DESCRIPTOR(name, reset) { #name, (reset), LMX2492FieldFirst(LMX2492_FIELD_##name), \
+		LMX2492FieldParts(LMX2492_FIELD_##name), LMX2492FieldWidth(LMX2492_FIELD_##name) },
+static constexpr LMX2492_Field_TypeDef fields[LMX2492_FIELD_COUNT] = {
+	LMX2492_FIELD_LIST(LMX2492_FIELD_DESCRIPTOR)
+};
+#undef LMX2492_FIELD_DESCRIPTOR
+
+const LMX2492_Field_TypeDef* LMX2492FieldDescriptor(uint8_t field)
+{
+	assert(field < LMX2492_FIELD_COUNT);
+
+	return &fields[field];
+}
+
+void LMX2492FieldWrite(uint8_t *data, uint16_t base, uint8_t field, uint64_t value)
+{
+	const LMX2492_Field_TypeDef *f = LMX2492FieldDescriptor(field);
+
+	for(uint16_t i = f->first; i < f->first + f->parts; ++i)
+	{
+		const LMX2492_Field_Part_TypeDef *p = &LMX2492_FIELD_PARTS[i];
+		uint8_t mask = LMX2492FieldPartMask(i);
+
+		assert(p->address >= base);
+
+		data[p->address - base] = (uint8_t)((data[p->address - base] & (uint8_t)~mask) | (((uint8_t)(value >> p->lsb) << p->offset) & mask));
+	}
+}
+
+uint64_t LMX2492FieldRead(const uint8_t *data, uint16_t base, uint8_t field)
+{
+	const LMX2492_Field_TypeDef *f = LMX2492FieldDescriptor(field);
+	uint64_t value = 0;
+
+	for(uint16_t i = f->first; i < f->first + f->parts; ++i)
+	{
+		const LMX2492_Field_Part_TypeDef *p = &LMX2492_FIELD_PARTS[i];
+
+		assert(p->address >= base);
+
+		value |= (uint64_t)((data[p->address - base] & LMX2492FieldPartMask(i)) >> p->offset) << p->lsb;
+	}
+
+	return value;
+}
+
+} /* namespace bsp */
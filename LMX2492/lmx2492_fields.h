@@ -0,0 +1,413 @@
+/*
+ * lmx2492_fields.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_FIELDS_H_
+#define LMX2492_FIELDS_H_
+
+#include <lmx2492_regdef.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Portable register field encoding. The field and part lists below are the single source
+// of the register map 0x00 ... 0x8D: the field ids, the descriptor tables, the POR image
+// and the template accessors are all generated from them. Unlike the bitfields of the
+// regdef structs the encoding does not depend on the compiler.
+//
+// LMX2492_FIELD_LIST:		F(name, POR value)
+// LMX2492_FIELD_PART_LIST:	P(name, address, bit offset, width, lsb)
+//   A part holds width bits at the bit offset of a register, these are the bits
+//   lsb ... lsb + width - 1 of the field value. Parts of a field are listed together.
+
+#define LMX2492_RAMP_FIELD_LIST(F, x) \
+	F(RAMP##x##_INC, 0) \
+	F(RAMP##x##_FL, 0) \
+	F(RAMP##x##_DLY, 0) \
+	F(RAMP##x##_LEN, 0) \
+	F(RAMP##x##_FLAG, 0) \
+	F(RAMP##x##_RST, 0) \
+	F(RAMP##x##_NEXT_TRIG, 0) \
+	F(RAMP##x##_NEXT, 0)
+
+#define LMX2492_FIELD_LIST(F) \
+	F(ID, 0x18) \
+	F(POWERDOWN, 0) \
+	F(SWRST, 0) \
+	F(PLL_N, 0) \
+	F(FRAC_DITHER, LMX2492_FRAC_DITHER_DISABLED) \
+	F(FRAC_ORDER, 0) \
+	F(FRAC_NUM, 0) \
+	F(FRAC_DEN, 0) \
+	F(PLL_R, 1) \
+	F(OSC_2X, 0) \
+	F(PLL_R_DIFF, 0) \
+	F(PFD_DLY, 1) \
+	F(FL_CSR, 0) \
+	F(CPG, 0) \
+	F(CPPOL, 0) \
+	F(FL_CPG, 0) \
+	F(FL_TOC, 0) \
+	F(CMP_THR_LOW, 0x0A) \
+	F(CMP_FLAGL, 0) \
+	F(CMP_THR_HIGH, 0x32) \
+	F(CMP_FLAGH, 0) \
+	F(DLD_PASS_CNT, 0x20) \
+	F(DLD_ERR_CNTR, 0x04) \
+	F(DLD_TOL, 0) \
+	F(GPIO_RESERVED_2_0, 1) \
+	F(GPIO_RESERVED_6, 1) \
+	F(TRIG1_MUX, 0) \
+	F(TRIG1_PIN, 0) \
+	F(TRIG2_MUX, 0) \
+	F(TRIG2_PIN, 0) \
+	F(MOD_MUX, 0) \
+	F(MOD_PIN, 0) \
+	F(MUXout_MUX, 0) \
+	F(MUXout_PIN, 0) \
+	F(RAMP_EN, 0) \
+	F(RAMP_CLK, 0) \
+	F(RAMP_PM_EN, 0) \
+	F(RAMP_TRIG_A, 0) \
+	F(RAMP_TRIG_B, 0) \
+	F(RAMP_TRIG_C, 0) \
+	F(RAMP_CMP0, 0) \
+	F(RAMP_CMP0_EN, 0) \
+	F(RAMP_CMP1, 0) \
+	F(RAMP_CMP1_EN, 0) \
+	F(FSK_DEV, 0) \
+	F(RAMP_LIMIT_LOW, 0) \
+	F(RAMP_LIMIT_HIGH, 0) \
+	F(FSK_TRIG, 0) \
+	F(RAMP_COUNT, 0) \
+	F(RAMP_AUTO, 0) \
+	F(RAMP_TRIG_INC, 0) \
+	LMX2492_RAMP_FIELD_LIST(F, 0) \
+	LMX2492_RAMP_FIELD_LIST(F, 1) \
+	LMX2492_RAMP_FIELD_LIST(F, 2) \
+	LMX2492_RAMP_FIELD_LIST(F, 3) \
+	LMX2492_RAMP_FIELD_LIST(F, 4) \
+	LMX2492_RAMP_FIELD_LIST(F, 5) \
+	LMX2492_RAMP_FIELD_LIST(F, 6) \
+	LMX2492_RAMP_FIELD_LIST(F, 7)
+
+// Ramp slot x at 0x56 + 7x
+#define LMX2492_RAMP_FIELD_PART_LIST(P, x) \
+	P(RAMP##x##_INC, 0x56 + 7 * x, 0, 8, 0) \
+	P(RAMP##x##_INC, 0x57 + 7 * x, 0, 8, 8) \
+	P(RAMP##x##_INC, 0x58 + 7 * x, 0, 8, 16) \
+	P(RAMP##x##_INC, 0x59 + 7 * x, 0, 6, 24) \
+	P(RAMP##x##_FL, 0x59 + 7 * x, 6, 1, 0) \
+	P(RAMP##x##_DLY, 0x59 + 7 * x, 7, 1, 0) \
+	P(RAMP##x##_LEN, 0x5A + 7 * x, 0, 8, 0) \
+	P(RAMP##x##_LEN, 0x5B + 7 * x, 0, 8, 8) \
+	P(RAMP##x##_FLAG, 0x5C + 7 * x, 0, 2, 0) \
+	P(RAMP##x##_RST, 0x5C + 7 * x, 2, 1, 0) \
+	P(RAMP##x##_NEXT_TRIG, 0x5C + 7 * x, 3, 2, 0) \
+	P(RAMP##x##_NEXT, 0x5C + 7 * x, 5, 3, 0)
+
+// 33 bit values, bit 32 is collected in register 0x46
+#define LMX2492_FIELD_PART_LIST_33(P, name, address, bit32) \
+	P(name, address, 0, 8, 0) \
+	P(name, address + 1, 0, 8, 8) \
+	P(name, address + 2, 0, 8, 16) \
+	P(name, address + 3, 0, 8, 24) \
+	P(name, 0x46, bit32, 1, 32)
+
+#define LMX2492_FIELD_PART_LIST(P) \
+	P(ID, 0x00, 0, 8, 0) \
+	P(POWERDOWN, 0x02, 0, 2, 0) \
+	P(SWRST, 0x02, 2, 1, 0) \
+	P(PLL_N, 0x10, 0, 8, 0) \
+	P(PLL_N, 0x11, 0, 8, 8) \
+	P(PLL_N, 0x12, 0, 2, 16) \
+	P(FRAC_DITHER, 0x12, 2, 2, 0) \
+	P(FRAC_ORDER, 0x12, 4, 3, 0) \
+	P(FRAC_NUM, 0x13, 0, 8, 0) \
+	P(FRAC_NUM, 0x14, 0, 8, 8) \
+	P(FRAC_NUM, 0x15, 0, 8, 16) \
+	P(FRAC_DEN, 0x16, 0, 8, 0) \
+	P(FRAC_DEN, 0x17, 0, 8, 8) \
+	P(FRAC_DEN, 0x18, 0, 8, 16) \
+	P(PLL_R, 0x19, 0, 8, 0) \
+	P(PLL_R, 0x1A, 0, 8, 8) \
+	P(OSC_2X, 0x1B, 0, 1, 0) \
+	P(PLL_R_DIFF, 0x1B, 2, 1, 0) \
+	P(PFD_DLY, 0x1B, 3, 2, 0) \
+	P(FL_CSR, 0x1B, 5, 2, 0) \
+	P(CPG, 0x1C, 0, 5, 0) \
+	P(CPPOL, 0x1C, 5, 1, 0) \
+	P(FL_CPG, 0x1D, 0, 5, 0) \
+	P(FL_TOC, 0x20, 0, 8, 0) \
+	P(FL_TOC, 0x1D, 5, 3, 8) \
+	P(CMP_THR_LOW, 0x1E, 0, 6, 0) \
+	P(CMP_FLAGL, 0x1E, 6, 1, 0) \
+	P(CMP_THR_HIGH, 0x1F, 0, 6, 0) \
+	P(CMP_FLAGH, 0x1F, 6, 1, 0) \
+	P(DLD_PASS_CNT, 0x21, 0, 8, 0) \
+	P(DLD_ERR_CNTR, 0x22, 0, 5, 0) \
+	P(DLD_TOL, 0x22, 5, 3, 0) \
+	P(GPIO_RESERVED_2_0, 0x23, 0, 3, 0) \
+	P(GPIO_RESERVED_6, 0x23, 6, 1, 0) \
+	P(TRIG1_MUX, 0x24, 3, 5, 0) \
+	P(TRIG1_MUX, 0x23, 3, 1, 5) \
+	P(TRIG1_PIN, 0x24, 0, 3, 0) \
+	P(TRIG2_MUX, 0x25, 3, 5, 0) \
+	P(TRIG2_MUX, 0x23, 4, 1, 5) \
+	P(TRIG2_PIN, 0x25, 0, 3, 0) \
+	P(MOD_MUX, 0x26, 3, 5, 0) \
+	P(MOD_MUX, 0x23, 7, 1, 5) \
+	P(MOD_PIN, 0x26, 0, 3, 0) \
+	P(MUXout_MUX, 0x27, 3, 5, 0) \
+	P(MUXout_MUX, 0x23, 5, 1, 5) \
+	P(MUXout_PIN, 0x27, 0, 3, 0) \
+	P(RAMP_EN, 0x3A, 0, 1, 0) \
+	P(RAMP_CLK, 0x3A, 1, 1, 0) \
+	P(RAMP_PM_EN, 0x3A, 2, 1, 0) \
+	P(RAMP_TRIG_A, 0x3A, 4, 4, 0) \
+	P(RAMP_TRIG_B, 0x3B, 0, 4, 0) \
+	P(RAMP_TRIG_C, 0x3B, 4, 4, 0) \
+	LMX2492_FIELD_PART_LIST_33(P, RAMP_CMP0, 0x3C, 0) \
+	P(RAMP_CMP0_EN, 0x40, 0, 8, 0) \
+	LMX2492_FIELD_PART_LIST_33(P, RAMP_CMP1, 0x41, 1) \
+	P(RAMP_CMP1_EN, 0x45, 0, 8, 0) \
+	LMX2492_FIELD_PART_LIST_33(P, FSK_DEV, 0x47, 2) \
+	LMX2492_FIELD_PART_LIST_33(P, RAMP_LIMIT_LOW, 0x4B, 3) \
+	LMX2492_FIELD_PART_LIST_33(P, RAMP_LIMIT_HIGH, 0x4F, 4) \
+	P(FSK_TRIG, 0x46, 5, 2, 0) \
+	P(RAMP_COUNT, 0x53, 0, 8, 0) \
+	P(RAMP_COUNT, 0x54, 0, 5, 8) \
+	P(RAMP_AUTO, 0x54, 5, 1, 0) \
+	P(RAMP_TRIG_INC, 0x54, 6, 2, 0) \
+	LMX2492_RAMP_FIELD_PART_LIST(P, 0) \
+	LMX2492_RAMP_FIELD_PART_LIST(P, 1) \
+	LMX2492_RAMP_FIELD_PART_LIST(P, 2) \
+	LMX2492_RAMP_FIELD_PART_LIST(P, 3) \
+	LMX2492_RAMP_FIELD_PART_LIST(P, 4) \
+	LMX2492_RAMP_FIELD_PART_LIST(P, 5) \
+	LMX2492_RAMP_FIELD_PART_LIST(P, 6) \
+	LMX2492_RAMP_FIELD_PART_LIST(P, 7)
+
+namespace bsp
+{
+
+	// Field ids LMX2492_FIELD_<name>
+#define LMX2492_FIELD_ENUM(name, reset) LMX2492_FIELD_##name,
+	enum
+	{
+		LMX2492_FIELD_LIST(LMX2492_FIELD_ENUM)
+		LMX2492_FIELD_COUNT
+	};
+#undef LMX2492_FIELD_ENUM
+
+// Field id of a ramp slot field, e.g. LMX2492_FIELD_RAMPx(NEXT, 3) for RAMP3_NEXT
+#define LMX2492_RAMP_FIELD_COUNT		(LMX2492_FIELD_RAMP1_INC - LMX2492_FIELD_RAMP0_INC)
+#define LMX2492_FIELD_RAMPx(name, x)	(LMX2492_FIELD_RAMP0_##name + LMX2492_RAMP_FIELD_COUNT * (x))
+
+	// Bits of a field in one register
+	typedef struct {
+		uint8_t field;
+		uint8_t address;
+		uint8_t offset;
+		uint8_t width;
+		uint8_t lsb;
+	} LMX2492_Field_Part_TypeDef;
+
+	// Field descriptor, the parts are first ... first + parts - 1 of LMX2492_FIELD_PARTS
+	typedef struct {
+		const char* name;
+		uint64_t reset;
+		uint16_t first;
+		uint8_t parts;
+		uint8_t width;
+	} LMX2492_Field_TypeDef;
+
+#define LMX2492_FIELD_PART(name, address, offset, width, lsb) { LMX2492_FIELD_##name, (address), (offset), (width), (lsb) },
+	constexpr LMX2492_Field_Part_TypeDef LMX2492_FIELD_PARTS[] = {
+		LMX2492_FIELD_PART_LIST(LMX2492_FIELD_PART)
+	};
+#undef LMX2492_FIELD_PART
+
+#define LMX2492_FIELD_PART_COUNT	(sizeof(LMX2492_FIELD_PARTS) / sizeof(LMX2492_FIELD_PARTS[0]))
+
+	// First part of a field
+	constexpr uint16_t LMX2492FieldFirst(uint8_t field)
+	{
+		uint16_t i = 0;
+
+		while((i < LMX2492_FIELD_PART_COUNT) && (LMX2492_FIELD_PARTS[i].field != field))
+			++i;
+
+		return i;
+	}
+
+	// Number of parts of a field
+	constexpr uint8_t LMX2492FieldParts(uint8_t field)
+	{
+		uint16_t i = LMX2492FieldFirst(field);
+		uint8_t count = 0;
+
+		while((i + count < LMX2492_FIELD_PART_COUNT) && (LMX2492_FIELD_PARTS[i + count].field == field))
+			++count;
+
+		return count;
+	}
+
+	// Width of a field in bits
+	constexpr uint8_t LMX2492FieldWidth(uint8_t field)
+	{
+		uint8_t width = 0;
+
+		for(uint16_t i = LMX2492FieldFirst(field); i < LMX2492FieldFirst(field) + LMX2492FieldParts(field); ++i)
+			width += LMX2492_FIELD_PARTS[i].width;
+
+		return width;
+	}
+
+	// Register bits of a part
+	constexpr uint8_t LMX2492FieldPartMask(uint16_t part)
+	{
+		return (uint8_t)(((1u << LMX2492_FIELD_PARTS[part].width) - 1u) << LMX2492_FIELD_PARTS[part].offset);
+	}
+
+	// Checks the lists: parts of a field listed together, parts within a register and
+	// registers within the map, no register bit used twice
+	constexpr bool LMX2492FieldListValid()
+	{
+		for(uint16_t i = 0; i < LMX2492_FIELD_PART_COUNT; ++i)
+		{
+			const LMX2492_Field_Part_TypeDef &p = LMX2492_FIELD_PARTS[i];
+
+			if((p.width == 0) || (p.offset + p.width > 8) || (p.address > LMX2492_LAST_ADDRESS)) return false;
+			if(LMX2492FieldFirst(p.field) + LMX2492FieldParts(p.field) <= i) return false;
+
+			for(uint16_t j = 0; j < i; ++j)
+			{
+				if((LMX2492_FIELD_PARTS[j].address == p.address) && (LMX2492FieldPartMask(j) & LMX2492FieldPartMask(i)))
+					return false;
+			}
+		}
+
+		for(uint8_t field = 0; field < LMX2492_FIELD_COUNT; ++field)
+		{
+			if(LMX2492FieldParts(field) == 0) return false;
+		}
+
+		return true;
+	}
+
+	static_assert(LMX2492FieldListValid(), "Invalid LMX2492 field list");
+
+	// Register image with the POR values of all fields
+	struct LMX2492_Reset_Image_TypeDef
+	{
+		uint8_t data[LMX2492_REGISTER_COUNT];
+
+		constexpr LMX2492_Reset_Image_TypeDef() : data()
+		{
+#define LMX2492_FIELD_RESET(name, reset) (reset),
+			const uint64_t resets[] = { LMX2492_FIELD_LIST(LMX2492_FIELD_RESET) };
+#undef LMX2492_FIELD_RESET
+
+			for(uint16_t i = 0; i < LMX2492_FIELD_PART_COUNT; ++i)
+			{
+				const LMX2492_Field_Part_TypeDef &p = LMX2492_FIELD_PARTS[i];
+				data[p.address] |= (uint8_t)(((resets[p.field] >> p.lsb) << p.offset) & LMX2492FieldPartMask(i));
+			}
+		}
+	};
+
+	constexpr LMX2492_Reset_Image_TypeDef LMX2492_RESET_IMAGE;
+
+	// Encoder of parts First ... Last - 1, all masks and shifts are constants.
+	// Single byte read-modify-writes, usable at compile time (see LMX2492Plan).
+	template<uint16_t First, uint16_t Last>
+	struct LMX2492FieldCodec
+	{
+		static constexpr void Set(uint8_t* data, uint16_t base, uint64_t value)
+		{
+			constexpr uint16_t address = LMX2492_FIELD_PARTS[First].address;
+			constexpr uint8_t offset = LMX2492_FIELD_PARTS[First].offset;
+			constexpr uint8_t lsb = LMX2492_FIELD_PARTS[First].lsb;
+			constexpr uint8_t mask = LMX2492FieldPartMask(First);
+
+			// Whole registers are plain stores
+			if(mask == 0xFF)
+				data[address - base] = (uint8_t)(value >> lsb);
+			else
+				data[address - base] = (uint8_t)((data[address - base] & (uint8_t)~mask) | (((uint8_t)(value >> lsb) << offset) & mask));
+
+			LMX2492FieldCodec<First + 1, Last>::Set(data, base, value);
+		}
+
+		static constexpr uint64_t Get(const uint8_t* data, uint16_t base)
+		{
+			constexpr uint16_t address = LMX2492_FIELD_PARTS[First].address;
+			constexpr uint8_t offset = LMX2492_FIELD_PARTS[First].offset;
+			constexpr uint8_t lsb = LMX2492_FIELD_PARTS[First].lsb;
+			constexpr uint8_t mask = LMX2492FieldPartMask(First);
+
+			return ((uint64_t)((data[address - base] & mask) >> offset) << lsb) | LMX2492FieldCodec<First + 1, Last>::Get(data, base);
+		}
+	};
+
+	template<uint16_t Last>
+	struct LMX2492FieldCodec<Last, Last>
+	{
+		static constexpr void Set(uint8_t*, uint16_t, uint64_t) { }
+		static constexpr uint64_t Get(const uint8_t*, uint16_t) { return 0; }
+	};
+
+	// Set a field (LMX2492_FIELD_*) in data holding the registers from address base,
+	// e.g. a LMX2492_Config_TypeDef with base LMX2492_CONFIG_ADDRESS. Other bits are kept.
+	template<uint8_t Field>
+	constexpr void LMX2492FieldSet(uint8_t* data, uint16_t base, uint64_t value)
+	{
+		static_assert(Field < LMX2492_FIELD_COUNT, "Unknown LMX2492 field");
+
+		LMX2492FieldCodec<LMX2492FieldFirst(Field), LMX2492FieldFirst(Field) + LMX2492FieldParts(Field)>::Set(data, base, value);
+	}
+
+	// Get a field from data holding the registers from address base
+	template<uint8_t Field>
+	constexpr uint64_t LMX2492FieldGet(const uint8_t* data, uint16_t base)
+	{
+		static_assert(Field < LMX2492_FIELD_COUNT, "Unknown LMX2492 field");
+
+		return LMX2492FieldCodec<LMX2492FieldFirst(Field), LMX2492FieldFirst(Field) + LMX2492FieldParts(Field)>::Get(data, base);
+	}
+
+	// Set a ramp field (LMX2492_FIELD_RAMP0_*) in a LMX2492_Ramp_TypeDef of any slot
+	template<uint8_t Field>
+	inline void LMX2492RampFieldSet(LMX2492_Ramp_TypeDef* ramp, uint64_t value)
+	{
+		static_assert((Field >= LMX2492_FIELD_RAMP0_INC) && (Field < LMX2492_FIELD_RAMP1_INC), "Not a LMX2492 RAMP0 field");
+
+		LMX2492FieldSet<Field>((uint8_t*)ramp, LMX2492_RAMP_ADDRESS(0), value);
+	}
+
+	// Get a ramp field (LMX2492_FIELD_RAMP0_*) from a LMX2492_Ramp_TypeDef of any slot
+	template<uint8_t Field>
+	inline uint64_t LMX2492RampFieldGet(const LMX2492_Ramp_TypeDef* ramp)
+	{
+		static_assert((Field >= LMX2492_FIELD_RAMP0_INC) && (Field < LMX2492_FIELD_RAMP1_INC), "Not a LMX2492 RAMP0 field");
+
+		return LMX2492FieldGet<Field>((const uint8_t*)ramp, LMX2492_RAMP_ADDRESS(0));
+	}
+
+	// Table driven access for field ids known at run time only, e.g. in host tools
+	const LMX2492_Field_TypeDef* LMX2492FieldDescriptor(uint8_t field);
+	void LMX2492FieldWrite(uint8_t* data, uint16_t base, uint8_t field, uint64_t value);
+	uint64_t LMX2492FieldRead(const uint8_t* data, uint16_t base, uint8_t field);
+
+	// The regdef structs must match the map for the encoder to write into them
+	static_assert(sizeof(LMX2492_Config_TypeDef) == 0x23 - LMX2492_CONFIG_ADDRESS, "LMX2492_Config_TypeDef layout");
+	static_assert(sizeof(LMX2492_GPIO_Config_TypeDef) == 0x28 - LMX2492_GPIO_CONFIG_ADDRESS, "LMX2492_GPIO_Config_TypeDef layout");
+	static_assert(sizeof(LMX2492_Ramp_Config_TypeDef) == 0x55 - LMX2492_RAMP_CONFIG_ADDRESS, "LMX2492_Ramp_Config_TypeDef layout");
+	static_assert(sizeof(LMX2492_Ramp_TypeDef) == 7, "LMX2492_Ramp_TypeDef layout");
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_FIELDS_H_ */
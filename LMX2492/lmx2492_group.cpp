@@ -0,0 +1,233 @@
+/*
+ * lmx2492_group.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_group.h>
+
+#include <assert.h>
+
+namespace bsp {
+
+LMX2492Group::LMX2492Group(LMX2492Driver *broadcast, LMX2492Driver * const *devices, uint8_t count)
+ : broadcast_(broadcast), devices_(devices), count_(count)
+{
+	assert(broadcast != NULL);
+	assert(devices != NULL);
+	assert(count > 0);
+}
+
+uint8_t LMX2492Group::Count() const
+{
+	return count_;
+}
+
+LMX2492Driver* LMX2492Group::Device(uint8_t index) const
+{
+	assert(index < count_);
+
+	return devices_[index];
+}
+
+bool LMX2492Group::Reset()
+{
+	uint8_t rst = LMX2492_SWRST_RESET;
+
+	if(broadcast_->record_ != NULL) return false;
+
+	// Same as LMX2492Driver::Reset(), the reset value must not end up in the register images
+	if(!broadcast_->TransmitMemory(LMX2492_SWRST_ADDR, &rst, 1)) return false;
+
+	InvalidateShadow();
+
+	return true;
+}
+
+void LMX2492Group::StageConfig(const LMX2492_Config_TypeDef* config)
+{
+	StageMemory(LMX2492_CONFIG_ADDRESS, (const uint8_t*)config, sizeof(LMX2492_Config_TypeDef));
+}
+
+void LMX2492Group::StageGPIOConfig(const LMX2492_GPIO_Config_TypeDef* gpio_config)
+{
+	StageMemory(LMX2492_GPIO_CONFIG_ADDRESS, (const uint8_t*)gpio_config, sizeof(LMX2492_GPIO_Config_TypeDef));
+}
+
+void LMX2492Group::StageRampConfig(const LMX2492_Ramp_Config_TypeDef* ramp_config)
+{
+	StageMemory(LMX2492_RAMP_CONFIG_ADDRESS, (const uint8_t*)ramp_config, sizeof(LMX2492_Ramp_Config_TypeDef));
+}
+
+void LMX2492Group::StageRamp(const LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx)
+{
+	assert(ramp_idx <= 7);
+
+	StageMemory(LMX2492_RAMP_ADDRESS(ramp_idx), (const uint8_t*)ramp, sizeof(LMX2492_Ramp_TypeDef));
+}
+
+void LMX2492Group::StageRamps(const LMX2492_Ramp_TypeDef* ramps)
+{
+	StageMemory(LMX2492_RAMP_ADDRESS(0), (const uint8_t*)ramps, sizeof(LMX2492_Ramp_TypeDef) * LMX2492_RAMP_COUNT);
+}
+
+void LMX2492Group::StagePowerConfig(uint8_t power_config)
+{
+	assert(power_config <= 2);
+
+	StageMemory(LMX2492_POWERDOWN_ADDR, &power_config, 1);
+}
+
+void LMX2492Group::StageMemory(uint16_t address, const uint8_t *data, size_t size)
+{
+	for(uint8_t i = 0; i < count_; ++i)
+		devices_[i]->StageMemory(address, data, size);
+}
+
+bool LMX2492Group::IsCommon(uint16_t address) const
+{
+	if(!devices_[0]->IsStaged(address))
+		return false;
+
+	for(uint8_t i = 1; i < count_; ++i)
+	{
+		if(!devices_[i]->IsStaged(address) || (devices_[i]->image_[address] != devices_[0]->image_[address]))
+			return false;
+	}
+
+	return true;
+}
+
+bool LMX2492Group::IsDirty(uint16_t address) const
+{
+	for(uint8_t i = 0; i < count_; ++i)
+	{
+		if(devices_[i]->IsDirty(address))
+			return true;
+	}
+
+	return false;
+}
+
+bool LMX2492Group::Commit()
+{
+	// Transmit buffers in use or writes recorded
+	if(broadcast_->SpiBusy() || (broadcast_->record_ != NULL)) return false;
+
+	for(uint8_t i = 0; i < count_; ++i)
+	{
+		if(devices_[i]->SpiBusy() || (devices_[i]->record_ != NULL)) return false;
+
+		devices_[i]->PrepareLatch();
+	}
+
+	// Walk the register map top down, same order as on LMX2492Driver::Commit()
+	int32_t address = LMX2492_LAST_ADDRESS;
+
+	while(address >= 0)
+	{
+		if(!IsDirty(address))
+		{
+			--address;
+			continue;
+		}
+
+		if(IsCommon(address))
+		{
+			int32_t first = CommonRange(address);
+
+			if(!Broadcast(first, address - first + 1)) return false;
+
+			// Continue below the range, trailing gap bytes are checked again
+			address = first - 1;
+		}
+		else
+		{
+			// Differing bytes down to the next common range are written per device
+			int32_t last = address;
+			int32_t first = address;
+
+			for(--address; address >= 0; --address)
+			{
+				if(IsCommon(address) && IsDirty(address))
+				{
+					int32_t low = CommonRange(address);
+
+					// Short common ranges next to differing bytes, e.g. the latch register
+					// below FRAC_NUM, are sent along instead of splitting the device frames
+					if((address - low + 1 > LMX2492_COMMIT_MERGE_GAP) || (first - address > LMX2492_COMMIT_MERGE_GAP + 1))
+						break;
+
+					first = address = low;
+				}
+				else if(IsDirty(address))
+				{
+					first = address;
+				}
+			}
+
+			for(uint8_t i = 0; i < count_; ++i)
+			{
+				if(!devices_[i]->CommitRange(last, address + 1)) return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void LMX2492Group::InvalidateShadow()
+{
+	for(uint8_t i = 0; i < count_; ++i)
+		devices_[i]->InvalidateShadow();
+}
+
+int32_t LMX2492Group::CommonRange(int32_t address) const
+{
+	// Extend the range downwards, bridge small gaps of common clean bytes
+	int32_t first = address;
+	uint8_t gap = 0;
+
+	for(--address; (address >= 0) && IsCommon(address); --address)
+	{
+		if(IsDirty(address))
+		{
+			first = address;
+			gap = 0;
+		}
+		else if(gap < LMX2492_COMMIT_MERGE_GAP)
+		{
+			++gap;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	return first;
+}
+
+bool LMX2492Group::Broadcast(uint16_t address, size_t size)
+{
+	// Common bytes, equal in all register images
+	const uint8_t *data = &devices_[0]->image_[address];
+
+	if(!broadcast_->TransmitMemory(address, data, size)) return false;
+
+	bool equal = true;
+
+	for(uint8_t i = 0; i < count_; ++i)
+	{
+		devices_[i]->UpdateShadow(address, data, size);
+
+		// Read back from each device separately
+		if(devices_[i]->verify_)
+			equal &= devices_[i]->VerifyMemory(address, &devices_[i]->image_[address], size);
+	}
+
+	return equal;
+}
+
+} /* namespace bsp */
@@ -0,0 +1,78 @@
+/*
+ * lmx2492_group.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_GROUP_H_
+#define LMX2492_GROUP_H_
+
+#include <lmx2492_driver.h>
+#include <stdint.h>
+#include <stddef.h>
+
+namespace bsp
+{
+
+	// Group of LMX2492 devices on one SPI bus, programmed by broadcast writes.
+	// The broadcast driver asserts the chip selects of all devices together, e.g. with
+	// cs_pin = CS0 | CS1 | ... if the CS pins share a GPIO port. On Linux SpiBroadcastDevice
+	// sends the broadcast to the devices in turn. Each device keeps its own register image
+	// and shadow: bytes staged equal in all devices are broadcast, bytes that differ are
+	// written to the devices individually. The broadcast driver is never read.
+	class LMX2492Group
+	{
+	public:
+		// Devices stored in a user provided array, e.g. a static array
+		LMX2492Group(LMX2492Driver* broadcast, LMX2492Driver* const* devices, uint8_t count);
+
+		// Number of devices
+		uint8_t Count() const;
+
+		// Device of the group, e.g. to stage device specific values
+		LMX2492Driver* Device(uint8_t index) const;
+
+		// Soft reset of all devices by one broadcast write
+		bool Reset();
+
+		// Stage in the register images of all devices, written on Commit()
+		void StageConfig(const LMX2492_Config_TypeDef* config);
+		void StageGPIOConfig(const LMX2492_GPIO_Config_TypeDef* gpio_config);
+		void StageRampConfig(const LMX2492_Ramp_Config_TypeDef* ramp_config);
+		void StageRamp(const LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx);
+		void StageRamps(const LMX2492_Ramp_TypeDef* ramps);
+		void StagePowerConfig(uint8_t power_config);
+		void StageMemory(uint16_t address, const uint8_t* data, size_t size);
+
+		// Write the staged bytes of all devices that differ from their shadows.
+		// The register map is walked top down: ranges staged equal in all devices are
+		// broadcast, ranges between them are committed per device. Every device sees its
+		// writes in descending address order as on LMX2492Driver::Commit().
+		// Returns false if a transfer failed or a driver is busy or recording.
+		bool Commit();
+
+		// Forget the known register contents of all devices
+		void InvalidateShadow();
+
+	private:
+		LMX2492Driver* broadcast_;
+		LMX2492Driver* const* devices_;
+		uint8_t count_;
+
+		// Byte staged with the same value in all devices
+		bool IsCommon(uint16_t address) const;
+
+		// Byte to be written to at least one device
+		bool IsDirty(uint16_t address) const;
+
+		// Lowest address of the range to broadcast starting at the common dirty byte address
+		int32_t CommonRange(int32_t address) const;
+
+		// Broadcast a range and update the shadows of all devices
+		bool Broadcast(uint16_t address, size_t size);
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_GROUP_H_ */
@@ -0,0 +1,108 @@
+/*
+ * lmx2492_hop_table.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_hop_table.h>
+#include <lmx2492_driver.h>
+
+#include <assert.h>
+#include "string.h"
+
+namespace bsp {
+
+LMX2492HopTable::LMX2492HopTable(LMX2492_Hop_TypeDef *entries, size_t capacity)
+ : entries_(entries), capacity_(capacity), count_(0)
+{
+	assert(entries != NULL);
+}
+
+bool LMX2492HopTable::Build(const LMX2492_Config_TypeDef *config, uint32_t fref, const uint64_t *frequencies, size_t count)
+{
+	assert(config != NULL);
+	assert(frequencies != NULL);
+
+	count_ = 0;
+
+	if(count > capacity_) return false;
+
+	const uint8_t *config_data = (const uint8_t*)config;
+	uint16_t R = (uint16_t)LMX2492FieldGet<LMX2492_FIELD_PLL_R>(config_data, LMX2492_CONFIG_ADDRESS);
+	uint8_t OSC_2X = (uint8_t)LMX2492FieldGet<LMX2492_FIELD_OSC_2X>(config_data, LMX2492_CONFIG_ADDRESS);
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		uint32_t N, FRAC_NUM, FRAC_DEN;
+		int64_t err = LMX2492Driver::DividerFromFrequencyHz(frequencies[i], fref, N, FRAC_NUM, FRAC_DEN, R, OSC_2X);
+
+		// Keep the other bits of the hop registers from the config
+		uint8_t hop[sizeof(LMX2492_Config_TypeDef)];
+		memcpy(hop, config, sizeof(LMX2492_Config_TypeDef));
+
+		LMX2492FieldSet<LMX2492_FIELD_PLL_N>(hop, LMX2492_CONFIG_ADDRESS, N);
+		LMX2492FieldSet<LMX2492_FIELD_FRAC_NUM>(hop, LMX2492_CONFIG_ADDRESS, FRAC_NUM);
+		LMX2492FieldSet<LMX2492_FIELD_FRAC_DEN>(hop, LMX2492_CONFIG_ADDRESS, FRAC_DEN);
+
+		LMX2492Driver::EncodeFrame(LMX2492_HOP_ADDRESS, &hop[LMX2492_HOP_ADDRESS - LMX2492_CONFIG_ADDRESS], LMX2492_HOP_SIZE, entries_[i].frame);
+		entries_[i].error = (int32_t)err;
+	}
+
+	count_ = count;
+
+	return true;
+}
+
+void LMX2492HopTable::Clear()
+{
+	count_ = 0;
+}
+
+size_t LMX2492HopTable::Count() const
+{
+	return count_;
+}
+
+const LMX2492_Hop_TypeDef* LMX2492HopTable::Entry(size_t index) const
+{
+	assert(index < count_);
+
+	return &entries_[index];
+}
+
+void LMX2492HopTable::Decode(size_t index, uint8_t *regs) const
+{
+	// Frame data is in descending address order
+	const uint8_t *data = &Entry(index)->frame[2];
+	for(size_t i = 0; i < LMX2492_HOP_SIZE; ++i)
+		regs[i] = data[LMX2492_HOP_SIZE - 1 - i];
+}
+
+uint32_t LMX2492HopTable::N(size_t index) const
+{
+	uint8_t regs[LMX2492_HOP_SIZE];
+	Decode(index, regs);
+	return LMX2492FieldGet<LMX2492_FIELD_PLL_N>(regs, LMX2492_HOP_ADDRESS);
+}
+
+uint32_t LMX2492HopTable::FracNum(size_t index) const
+{
+	uint8_t regs[LMX2492_HOP_SIZE];
+	Decode(index, regs);
+	return LMX2492FieldGet<LMX2492_FIELD_FRAC_NUM>(regs, LMX2492_HOP_ADDRESS);
+}
+
+uint32_t LMX2492HopTable::FracDen(size_t index) const
+{
+	uint8_t regs[LMX2492_HOP_SIZE];
+	Decode(index, regs);
+	return LMX2492FieldGet<LMX2492_FIELD_FRAC_DEN>(regs, LMX2492_HOP_ADDRESS);
+}
+
+int32_t LMX2492HopTable::Error(size_t index) const
+{
+	return Entry(index)->error;
+}
+
+} /* namespace bsp */
@@ -0,0 +1,69 @@
+/*
+ * lmx2492_hop_table.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_HOP_TABLE_H_
+#define LMX2492_HOP_TABLE_H_
+
+#include <lmx2492_regdef.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// A hop rewrites PLL_N, FRAC_NUM and FRAC_DEN (0x10 ... 0x18), the latch register 0x10 is sent last
+#define LMX2492_HOP_ADDRESS		LMX2492_PLL_LATCH_ADDR
+#define LMX2492_HOP_SIZE		(LMX2492_PLL_BUFFERED_LAST_ADDRESS - LMX2492_PLL_LATCH_ADDR + 1)
+#define LMX2492_HOP_FRAME_SIZE	(2 + LMX2492_HOP_SIZE)
+
+namespace bsp
+{
+
+	// Precomputed hop: encoded SPI write frame and the achieved frequency error
+	typedef struct {
+		uint8_t frame[LMX2492_HOP_FRAME_SIZE];
+		int32_t error; // mHz
+	} LMX2492_Hop_TypeDef;
+
+	// Table of precomputed frequency hops, sent by LMX2492Driver::Hop()
+	class LMX2492HopTable
+	{
+	public:
+		// Table stored in a user provided array, e.g. a static array
+		LMX2492HopTable(LMX2492_Hop_TypeDef* entries, size_t capacity);
+
+		// Precompute the hops for a list of frequencies in Hz.
+		// config provides PLL_R, OSC_2X and the FRAC_ORDER / FRAC_DITHER bits sharing register 0x12.
+		// Returns false if the table is too small, the table is left empty then.
+		bool Build(const LMX2492_Config_TypeDef* config, uint32_t fref, const uint64_t* frequencies, size_t count);
+
+		// Remove all hops
+		void Clear();
+
+		// Number of hops
+		size_t Count() const;
+
+		// Hop entry
+		const LMX2492_Hop_TypeDef* Entry(size_t index) const;
+
+		// Divider values of a hop
+		uint32_t N(size_t index) const;
+		uint32_t FracNum(size_t index) const;
+		uint32_t FracDen(size_t index) const;
+
+		// Achieved frequency error of a hop in mHz
+		int32_t Error(size_t index) const;
+
+	private:
+		LMX2492_Hop_TypeDef* entries_;
+		size_t capacity_;
+		size_t count_;
+
+		// Register bytes 0x10 ... 0x18 of a hop in ascending address order
+		void Decode(size_t index, uint8_t* regs) const;
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_HOP_TABLE_H_ */
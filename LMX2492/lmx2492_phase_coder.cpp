@@ -0,0 +1,209 @@
+/*
+ * lmx2492_phase_coder.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_phase_coder.h>
+#include <lmx2492_driver.h>
+#include <lmx2492_fields.h>
+
+#include <assert.h>
+#include "string.h"
+
+// Length of the hold slot at the end of a code that is not repeated
+#define PM_HOLD_LEN		2
+
+namespace bsp {
+
+// Phase difference wrapped to (-180, 180] degrees, millidegrees
+static int32_t wrap_phase(int64_t phase)
+{
+	phase %= LMX2492_PM_MDEG_CYCLE;
+
+	if(phase <= -LMX2492_PM_MDEG_CYCLE / 2) phase += LMX2492_PM_MDEG_CYCLE;
+	if(phase > LMX2492_PM_MDEG_CYCLE / 2) phase -= LMX2492_PM_MDEG_CYCLE;
+
+	return (int32_t)phase;
+}
+
+// round(a / b) for b > 0
+static int64_t div_round(int64_t a, int64_t b)
+{
+	return (a >= 0) ? (a + b / 2) / b : -((-a + b / 2) / b);
+}
+
+LMX2492PhaseCoder::LMX2492PhaseCoder(uint32_t fref, uint16_t R, uint8_t OSC_2X, uint32_t finc)
+ : fref_(fref), R_(R), osc_2x_(OSC_2X), finc_(finc), slots_(0), timing_error_(0)
+{
+	assert(fref > 0);
+	assert(R > 0);
+	assert(OSC_2X <= 0x1);
+	assert((uint64_t)fref * (OSC_2X + 1) <= 0xFFFFFFFF);
+
+	memset(ramps_, 0, sizeof(ramps_));
+	memset(inc_, 0, sizeof(inc_));
+}
+
+bool LMX2492PhaseCoder::Compile(const int32_t *phases, size_t count, uint32_t chip_duration, bool repeat, uint8_t trigger)
+{
+	assert(phases != NULL);
+	assert(trigger <= LMX2492_RAMPx_NEXT_TRIG_TRIG_C);
+
+	memset(ramps_, 0, sizeof(ramps_));
+	memset(inc_, 0, sizeof(inc_));
+	slots_ = 0;
+	timing_error_ = 0;
+
+	if((count == 0) || (count > LMX2492_PM_MAX_CHIPS)) return false;
+
+	// Ramp clock finc = clk_num / clk_den
+	uint64_t clk_num = (finc_ != 0) ? finc_ : (uint64_t)fref_ * (osc_2x_ + 1);
+	uint64_t clk_den = (finc_ != 0) ? 1 : R_;
+	uint64_t div = clk_den * 1000000000ULL;
+
+	// Rounding residual of the cycle count in 1 / div cycles, kept within [-div / 2, div / 2)
+	int64_t cycle_residual = 0;
+
+	// Repeated codes step from the last chip to the first one, others start without a step
+	int64_t phase = repeat ? phases[count - 1] : phases[0];
+	// Unwrapped phase and its value in RAMPx_INC LSBs
+	int64_t unwrapped = 0;
+	int64_t acc_inc = 0;
+
+	for(size_t i = 0; i < count; )
+	{
+		// Chips of equal phase share a slot
+		size_t chips = 1;
+
+		while((i + chips < count) && (wrap_phase((int64_t)phases[i + chips] - phases[i]) == 0))
+			++chips;
+
+		if(slots_ >= LMX2492_RAMP_COUNT) return false;
+
+		uint64_t duration = (uint64_t)chips * chip_duration;
+		if(duration > (UINT64_MAX - div) / clk_num) return false;
+
+		// Cycles up to the end of the run, rounded from the accumulated time
+		uint64_t acc = duration * clk_num + div / 2 + cycle_residual;
+		uint64_t cycles = acc / div;
+		cycle_residual = (int64_t)(acc - cycles * div) - (int64_t)(div / 2);
+
+		if((cycles == 0) || (cycles > 0xFFFF)) return false;
+
+		// Step rounded from the accumulated phase, the rounding errors do not add up
+		unwrapped += wrap_phase((int64_t)phases[i] - phase);
+		phase = phases[i];
+
+		int64_t next_inc = div_round(unwrapped * LMX2492_PM_INC_CYCLE, LMX2492_PM_MDEG_CYCLE);
+		uint32_t INC = (uint32_t)(next_inc - acc_inc) & 0x3FFFFFFF;
+		acc_inc = next_inc;
+
+		LMX2492Driver::SimpleRamp(&ramps_[slots_], INC, (uint16_t)cycles, (slots_ + 1) & 0x07);
+		inc_[slots_] = INC;
+		++slots_;
+
+		i += chips;
+	}
+
+	if(repeat)
+	{
+		LMX2492RampFieldSet<LMX2492_FIELD_RAMP0_NEXT>(&ramps_[slots_ - 1], 0);
+		LMX2492RampFieldSet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(&ramps_[slots_ - 1], trigger);
+	}
+	else
+	{
+		// Hold the last phase without further steps
+		if(slots_ >= LMX2492_RAMP_COUNT) return false;
+
+		LMX2492Driver::SimpleRamp(&ramps_[slots_], 0, PM_HOLD_LEN, slots_);
+		++slots_;
+	}
+
+	// Achieved minus requested, residual / clk_num is the time error in ns
+	timing_error_ = (cycle_residual >= 0) ? -((cycle_residual + (int64_t)clk_num / 2) / (int64_t)clk_num)
+			: (-cycle_residual + (int64_t)clk_num / 2) / (int64_t)clk_num;
+
+	return true;
+}
+
+bool LMX2492PhaseCoder::CompileBinary(const int8_t *chips, size_t count, uint32_t chip_duration, bool repeat, uint8_t trigger)
+{
+	assert(chips != NULL);
+
+	int32_t phases[LMX2492_PM_MAX_CHIPS];
+
+	if((count == 0) || (count > LMX2492_PM_MAX_CHIPS)) return false;
+
+	for(size_t i = 0; i < count; ++i)
+		phases[i] = (chips[i] > 0) ? 0 : LMX2492_PM_MDEG_CYCLE / 2;
+
+	return Compile(phases, count, chip_duration, repeat, trigger);
+}
+
+const LMX2492_Ramp_TypeDef* LMX2492PhaseCoder::Ramps() const
+{
+	return ramps_;
+}
+
+uint8_t LMX2492PhaseCoder::Slots() const
+{
+	return slots_;
+}
+
+int32_t LMX2492PhaseCoder::PhaseStep(uint8_t slot) const
+{
+	assert(slot < slots_);
+
+	// Sign extend the 30 bit two's complement
+	int64_t inc = (inc_[slot] & 0x20000000) ? (int64_t)inc_[slot] - 0x40000000 : (int64_t)inc_[slot];
+
+	return (int32_t)div_round(inc * LMX2492_PM_MDEG_CYCLE, LMX2492_PM_INC_CYCLE);
+}
+
+int64_t LMX2492PhaseCoder::TimingError() const
+{
+	return timing_error_;
+}
+
+bool LMX2492PhaseCoder::Upload(LMX2492Driver *driver, const LMX2492_Ramp_Config_TypeDef *ramp_config) const
+{
+	assert(driver != NULL);
+	assert(ramp_config != NULL);
+
+	LMX2492_Ramp_Config_TypeDef config = *ramp_config;
+
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_PM_EN>((uint8_t*)&config, LMX2492_RAMP_CONFIG_ADDRESS, LMX2492_RAMP_PM_EN_PM);
+
+	// Ramps and ramp config are merged into one transfer
+	driver->StageRamps(ramps_);
+	driver->StageRampConfig(&config);
+
+	return driver->Commit();
+}
+
+const int8_t* LMX2492PhaseCoder::Barker(uint8_t length)
+{
+	static const int8_t barker2[] = { 1, -1 };
+	static const int8_t barker3[] = { 1, 1, -1 };
+	static const int8_t barker4[] = { 1, 1, -1, 1 };
+	static const int8_t barker5[] = { 1, 1, 1, -1, 1 };
+	static const int8_t barker7[] = { 1, 1, 1, -1, -1, 1, -1 };
+	static const int8_t barker11[] = { 1, 1, 1, -1, -1, -1, 1, -1, -1, 1, -1 };
+	static const int8_t barker13[] = { 1, 1, 1, 1, 1, -1, -1, 1, 1, -1, 1, -1, 1 };
+
+	switch(length)
+	{
+	case 2: return barker2;
+	case 3: return barker3;
+	case 4: return barker4;
+	case 5: return barker5;
+	case 7: return barker7;
+	case 11: return barker11;
+	case 13: return barker13;
+	default: return NULL;
+	}
+}
+
+} /* namespace bsp */
@@ -0,0 +1,81 @@
+/*
+ * lmx2492_phase_coder.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_PHASE_CODER_H_
+#define LMX2492_PHASE_CODER_H_
+
+#include <lmx2492_regdef.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Max. number of chips of a phase code
+#define LMX2492_PM_MAX_CHIPS		64
+
+// Phase in millidegrees
+#define LMX2492_PM_MDEG_CYCLE		360000L
+
+// Phase step of a PM ramp (RAMP_PM_EN) per RAMPx_INC LSB: RAMPx_INC is added to the
+// fractional divider for one cycle, the output advances by RAMPx_INC / 2^24 cycles.
+#define LMX2492_PM_INC_CYCLE		(1L << 24)
+
+namespace bsp
+{
+
+	class LMX2492Driver;
+
+	// Compiles phase codes (e.g. Barker codes) into the ramp slots for phase modulation.
+	// In PM mode every ramp slot steps the phase by RAMPx_INC when it starts and holds it for
+	// RAMPx_LEN ramp clocks. Consecutive chips of equal phase share a slot, so all Barker codes
+	// fit the eight slots. Phases are relative, steps are taken the short way round.
+	class LMX2492PhaseCoder
+	{
+	public:
+		// finc .. ramp increment frequency in Hz (set to zero if fPFD is used)
+		LMX2492PhaseCoder(uint32_t fref, uint16_t R = 1, uint8_t OSC_2X = 0, uint32_t finc = 0);
+
+		// Compile a code of chip phases in millidegrees, each chip lasts chip_duration ns.
+		// repeat .. continue with the first chip after the last one, else hold the last phase
+		// trigger .. LMX2492_RAMPx_NEXT_TRIG_* to wait for before each repetition
+		// Returns false if the code does not fit the ramp slots or a chip is too short or too long.
+		bool Compile(const int32_t* phases, size_t count, uint32_t chip_duration, bool repeat = true, uint8_t trigger = LMX2492_RAMPx_NEXT_TRIG_NONE);
+
+		// Compile a binary phase code, chips > 0 at 0 degrees, chips <= 0 at 180 degrees
+		bool CompileBinary(const int8_t* chips, size_t count, uint32_t chip_duration, bool repeat = true, uint8_t trigger = LMX2492_RAMPx_NEXT_TRIG_NONE);
+
+		// All ramp slots (0x56 ... 0x8D), unused slots are zero
+		const LMX2492_Ramp_TypeDef* Ramps() const;
+
+		// Number of used ramp slots
+		uint8_t Slots() const;
+
+		// Phase step of a slot in millidegrees, after rounding to RAMPx_INC
+		int32_t PhaseStep(uint8_t slot) const;
+
+		// Timing error of the code end in ns
+		int64_t TimingError() const;
+
+		// Stage the ramps and ramp_config with RAMP_PM_EN set and write them by one Commit()
+		bool Upload(LMX2492Driver* driver, const LMX2492_Ramp_Config_TypeDef* ramp_config) const;
+
+		// Barker code of length 2, 3, 4, 5, 7, 11 or 13 (+1 / -1 chips), NULL for other lengths
+		static const int8_t* Barker(uint8_t length);
+
+	private:
+		uint32_t fref_;
+		uint16_t R_;
+		uint8_t osc_2x_;
+		uint32_t finc_;
+
+		LMX2492_Ramp_TypeDef ramps_[LMX2492_RAMP_COUNT];
+		uint32_t inc_[LMX2492_RAMP_COUNT];
+		uint8_t slots_;
+		int64_t timing_error_;
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_PHASE_CODER_H_ */
@@ -0,0 +1,316 @@
+/*
+ * lmx2492_plan.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_PLAN_H_
+#define LMX2492_PLAN_H_
+
+// Compile time frequency planning (requires C++14).
+// All functions are constexpr and use integer arithmetic only, the resulting
+// register images can be placed in flash and transmitted without any
+// computation at boot.
+
+#include <lmx2492_regdef.h>
+#include <lmx2492_fields.h>
+#include <best_rational.h>
+
+#include <assert.h>
+#include <stddef.h>
+
+namespace bsp
+{
+
+	// Register contents of a block of N consecutive addresses, ascending order
+	template<size_t N>
+	struct LMX2492Bytes {
+		uint8_t data[N];
+	};
+
+	// Register block sizes
+	#define LMX2492_CONFIG_SIZE			sizeof(LMX2492_Config_TypeDef)
+	#define LMX2492_GPIO_CONFIG_SIZE	sizeof(LMX2492_GPIO_Config_TypeDef)
+	#define LMX2492_RAMP_CONFIG_SIZE	sizeof(LMX2492_Ramp_Config_TypeDef)
+	#define LMX2492_RAMP_SIZE			sizeof(LMX2492_Ramp_TypeDef)
+
+	// constexpr versions of the LMX2492Driver builders, encoded with the field tables of
+	// lmx2492_fields.h (first field in the LSBs like the bitfields of the register structs).
+	class LMX2492Plan
+	{
+	public:
+		// POR contents of a register block starting at address
+		template<size_t N>
+		static constexpr LMX2492Bytes<N> ResetBytes(uint16_t address)
+		{
+			LMX2492Bytes<N> b = {};
+
+			for(size_t i = 0; i < N; ++i)
+				b.data[i] = LMX2492_RESET_IMAGE.data[address + i];
+
+			return b;
+		}
+
+		// Best rational approximation num / den of p / q (p < q) with den <= max_den
+		static constexpr void BestRational(uint64_t p, uint64_t q, uint32_t max_den, uint32_t& num, uint32_t& den)
+		{
+			assert(q <= 0xFFFFFFFFULL);
+
+			best_rational((uint32_t)p, (uint32_t)q, max_den, num, den);
+		}
+
+		// Calculate pll divider values from integer frequencies in Hz
+		static constexpr void DividerFromFrequency(uint64_t fout, uint64_t fref, uint32_t& N, uint32_t& FRAC_NUM, uint32_t& FRAC_DEN, uint16_t R = 1, uint8_t OSC_2X = 0)
+		{
+			assert(fref > 0);
+			assert(fout >= fref);
+			assert(R > 0);
+			assert(OSC_2X <= 0x1);
+
+			// Ndiv = fout / fPFD = fout * R / (fref * (OSC_2X + 1))
+			uint64_t num = fout * R;
+			uint64_t den = fref * (OSC_2X + 1);
+
+			N = (uint32_t)(num / den);
+
+			// Exact fraction limited to the 24 bit denominator
+			BestRational(num % den, den, 0xFFFFFF, FRAC_NUM, FRAC_DEN);
+
+			if(FRAC_NUM == 0)
+				FRAC_DEN = 1;
+		}
+
+		// round(a * 2^24 / b) for 0 < b < 2^56, result < 2^40
+		static constexpr uint64_t ScaleFrac24(uint64_t a, uint64_t b)
+		{
+			assert(b > 0);
+			assert(b < (1ULL << 56));
+
+			uint64_t q = a / b;
+			uint64_t r = a % b;
+
+			// Check if result fits
+			assert(q < (1ULL << 16));
+
+			// Long division in 8 bit steps, r < b keeps r << 8 within 64 bits
+			for(int i = 0; i < 3; ++i)
+			{
+				r <<= 8;
+				q = (q << 8) | (r / b);
+				r %= b;
+			}
+
+			// Round to nearest
+			return q + ((2 * r >= b) ? 1 : 0);
+		}
+
+		// Calculate ramp INC and LEN from integer values
+		// df .. Frequency delta of the ramp in Hz, may be negative
+		// duration .. the ramp duration in ns
+		// finc .. ramp increment frequency in Hz (set to zero if fPFD is used)
+		static constexpr void RampFromFrequency(int64_t df, uint64_t fref, uint64_t duration, uint32_t& INC, uint16_t& LEN, uint64_t finc = 0, uint16_t R = 1, uint8_t OSC_2X = 0)
+		{
+			assert(fref > 0);
+			assert(R > 0);
+			assert(OSC_2X <= 0x1);
+
+			// fPFD = fref * (OSC_2X + 1) / R
+			uint64_t pfd_num = fref * (OSC_2X + 1);
+
+			// LEN = round(duration * finc), finc = fPFD if not given
+			uint64_t len = (finc != 0) ? (duration * finc + 500000000ULL) / 1000000000ULL
+					: (duration * pfd_num + 500000000ULL * R) / (1000000000ULL * R);
+
+			// Check if value fits in uint16
+			assert((len > 0) && (len <= 0xFFFF));
+			LEN = (uint16_t)len;
+
+			// INC = df / fPFD * 2^24 / LEN
+			uint64_t mag = (uint64_t)((df < 0) ? -df : df);
+			uint64_t inc = ScaleFrac24(mag * R, pfd_num * LEN);
+
+			// Check if value fits in 30 bit two's complement register
+			assert(inc <= 0x1FFFFFFF);
+
+			INC = (uint32_t)((df < 0) ? ((0x40000000 - inc) & 0x3FFFFFFF) : inc);
+		}
+
+		// Generate simple PLL configuration with a limited feature set from divider values
+		static constexpr LMX2492Bytes<LMX2492_CONFIG_SIZE> SimpleConfig(uint32_t N, uint8_t CPPOL, uint8_t CPG, uint32_t FRAC_NUM, uint32_t FRAC_DEN, uint16_t R, uint8_t OSC_2X)
+		{
+			// assert parameters
+			assert(N <= 0x3FFFF);
+			assert(CPPOL <= 0x1);
+			assert(CPG <= 31);
+			assert(FRAC_NUM <= 0xFFFFFF);
+			assert(FRAC_DEN <= 0xFFFFFF);
+			assert(OSC_2X <= 0x1);
+
+			LMX2492Bytes<LMX2492_CONFIG_SIZE> b = ResetBytes<LMX2492_CONFIG_SIZE>(LMX2492_CONFIG_ADDRESS);
+
+			LMX2492FieldSet<LMX2492_FIELD_PLL_N>(b.data, LMX2492_CONFIG_ADDRESS, N);
+			LMX2492FieldSet<LMX2492_FIELD_FRAC_ORDER>(b.data, LMX2492_CONFIG_ADDRESS, LMX2492_FRAC_ORDER_2);
+			LMX2492FieldSet<LMX2492_FIELD_FRAC_NUM>(b.data, LMX2492_CONFIG_ADDRESS, FRAC_NUM);
+			LMX2492FieldSet<LMX2492_FIELD_FRAC_DEN>(b.data, LMX2492_CONFIG_ADDRESS, FRAC_DEN);
+			LMX2492FieldSet<LMX2492_FIELD_PLL_R>(b.data, LMX2492_CONFIG_ADDRESS, R);
+			LMX2492FieldSet<LMX2492_FIELD_OSC_2X>(b.data, LMX2492_CONFIG_ADDRESS, OSC_2X);
+			LMX2492FieldSet<LMX2492_FIELD_CPG>(b.data, LMX2492_CONFIG_ADDRESS, CPG);
+			LMX2492FieldSet<LMX2492_FIELD_CPPOL>(b.data, LMX2492_CONFIG_ADDRESS, CPPOL);
+
+			return b;
+		}
+
+		// Generate simple PLL configuration with a limited feature set from integer frequencies in Hz
+		static constexpr LMX2492Bytes<LMX2492_CONFIG_SIZE> SimpleConfig(uint64_t fout, uint64_t fref, uint8_t CPPOL, uint8_t CPG, uint16_t R, uint8_t OSC_2X)
+		{
+			uint32_t N = 0, FRAC_NUM = 0, FRAC_DEN = 0;
+
+			DividerFromFrequency(fout, fref, N, FRAC_NUM, FRAC_DEN, R, OSC_2X);
+
+			return SimpleConfig(N, CPPOL, CPG, FRAC_NUM, FRAC_DEN, R, OSC_2X);
+		}
+
+		// Generate simple PLL GPIO configuration
+		static constexpr LMX2492Bytes<LMX2492_GPIO_CONFIG_SIZE> SimpleGPIOConfig(
+				uint8_t TRIG1_MUX = LMX2492_MUX_IN_TRIG1, uint8_t TRIG1_PIN = LMX2492_PIN_TRISTATE,
+				uint8_t TRIG2_MUX = LMX2492_MUX_IN_TRIG2, uint8_t TRIG2_PIN = LMX2492_PIN_TRISTATE,
+				uint8_t MOD_MUX = LMX2492_MUX_IN_MOD, uint8_t MOD_PIN = LMX2492_PIN_TRISTATE,
+				uint8_t MUXout_MUX = LMX2492_MUX_OUT_LD, uint8_t MUXout_PIN = LMX2492_PIN_TRISTATE)
+		{
+			assert(TRIG1_MUX <= 38);
+			assert(TRIG1_PIN <= 7);
+			assert(TRIG2_MUX <= 38);
+			assert(TRIG2_PIN <= 7);
+			assert(MOD_MUX <= 38);
+			assert(MOD_PIN <= 7);
+			assert(MUXout_MUX <= 38);
+			assert(MUXout_PIN <= 7);
+
+			LMX2492Bytes<LMX2492_GPIO_CONFIG_SIZE> b = ResetBytes<LMX2492_GPIO_CONFIG_SIZE>(LMX2492_GPIO_CONFIG_ADDRESS);
+
+			LMX2492FieldSet<LMX2492_FIELD_TRIG1_MUX>(b.data, LMX2492_GPIO_CONFIG_ADDRESS, TRIG1_MUX);
+			LMX2492FieldSet<LMX2492_FIELD_TRIG1_PIN>(b.data, LMX2492_GPIO_CONFIG_ADDRESS, TRIG1_PIN);
+			LMX2492FieldSet<LMX2492_FIELD_TRIG2_MUX>(b.data, LMX2492_GPIO_CONFIG_ADDRESS, TRIG2_MUX);
+			LMX2492FieldSet<LMX2492_FIELD_TRIG2_PIN>(b.data, LMX2492_GPIO_CONFIG_ADDRESS, TRIG2_PIN);
+			LMX2492FieldSet<LMX2492_FIELD_MOD_MUX>(b.data, LMX2492_GPIO_CONFIG_ADDRESS, MOD_MUX);
+			LMX2492FieldSet<LMX2492_FIELD_MOD_PIN>(b.data, LMX2492_GPIO_CONFIG_ADDRESS, MOD_PIN);
+			LMX2492FieldSet<LMX2492_FIELD_MUXout_MUX>(b.data, LMX2492_GPIO_CONFIG_ADDRESS, MUXout_MUX);
+			LMX2492FieldSet<LMX2492_FIELD_MUXout_PIN>(b.data, LMX2492_GPIO_CONFIG_ADDRESS, MUXout_PIN);
+
+			return b;
+		}
+
+		// Generate simple ramp config with a limited feature set
+		static constexpr LMX2492Bytes<LMX2492_RAMP_CONFIG_SIZE> SimpleRampConfig(uint8_t RAMP_EN = 1, uint8_t RAMP_CLK = 0, uint8_t RAMP_TRIGA = 0, uint16_t RAMP_COUNT = 0)
+		{
+			assert(RAMP_EN <= 1);
+			assert(RAMP_CLK <= 1);
+			assert(RAMP_TRIGA <= 15);
+			assert(RAMP_COUNT <= 0x1FFF);
+
+			LMX2492Bytes<LMX2492_RAMP_CONFIG_SIZE> b = ResetBytes<LMX2492_RAMP_CONFIG_SIZE>(LMX2492_RAMP_CONFIG_ADDRESS);
+
+			LMX2492FieldSet<LMX2492_FIELD_RAMP_EN>(b.data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_EN);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP_CLK>(b.data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_CLK);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP_TRIG_A>(b.data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_TRIGA);
+
+			LMX2492FieldSet<LMX2492_FIELD_RAMP_COUNT>(b.data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_COUNT);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP_AUTO>(b.data, LMX2492_RAMP_CONFIG_ADDRESS, RAMP_COUNT != 0);
+
+			// Max. high limit, min. low limit (twos complement 33 bit)
+			LMX2492FieldSet<LMX2492_FIELD_RAMP_LIMIT_HIGH>(b.data, LMX2492_RAMP_CONFIG_ADDRESS, 0x0FFFFFFFFULL);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP_LIMIT_LOW>(b.data, LMX2492_RAMP_CONFIG_ADDRESS, 0x100000000ULL);
+
+			return b;
+		}
+
+		// Generate simple ramp with a limited feature set
+		static constexpr LMX2492Bytes<LMX2492_RAMP_SIZE> SimpleRamp(uint32_t RAMP_INC, uint16_t RAMP_LEN, uint8_t RAMP_NEXT = 0, uint8_t RAMP_RST = 0, uint8_t RAMP_NEXT_TRIG = 0, uint8_t RAMP_DLY = 0)
+		{
+			assert(RAMP_INC <= 0x3FFFFFFF);
+			assert(RAMP_NEXT <= 7);
+			assert(RAMP_RST <= 1);
+			assert(RAMP_NEXT_TRIG <= 4);
+			assert(RAMP_DLY <= 1);
+
+			LMX2492Bytes<LMX2492_RAMP_SIZE> b = {};
+
+			// Encoded as slot 0, all slots share the layout
+			LMX2492FieldSet<LMX2492_FIELD_RAMP0_INC>(b.data, LMX2492_RAMP_ADDRESS(0), RAMP_INC);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP0_DLY>(b.data, LMX2492_RAMP_ADDRESS(0), RAMP_DLY);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP0_LEN>(b.data, LMX2492_RAMP_ADDRESS(0), RAMP_LEN);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP0_RST>(b.data, LMX2492_RAMP_ADDRESS(0), RAMP_RST);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(b.data, LMX2492_RAMP_ADDRESS(0), RAMP_NEXT_TRIG);
+			LMX2492FieldSet<LMX2492_FIELD_RAMP0_NEXT>(b.data, LMX2492_RAMP_ADDRESS(0), RAMP_NEXT);
+
+			return b;
+		}
+	};
+
+	// Ready to transmit write sequence built at compile time, same format as
+	// LMX2492Sequence: frames of a length byte, the address header and the data
+	// in descending address order. Declare as static constexpr to place it in flash.
+	template<size_t Capacity>
+	class LMX2492Image
+	{
+	public:
+		constexpr LMX2492Image() : data_(), size_(0) { }
+
+		// Append a write frame of a register block starting at address
+		template<size_t N>
+		constexpr LMX2492Image& Write(uint16_t address, const LMX2492Bytes<N>& bytes)
+		{
+			return Write(address, bytes.data, N);
+		}
+
+		// Append a write frame of size bytes starting at address
+		constexpr LMX2492Image& Write(uint16_t address, const uint8_t* data, size_t size)
+		{
+			assert(size > 0);
+			assert(address + size <= LMX2492_REGISTER_COUNT);
+			// Length byte, header and data
+			assert(size_ + 3 + size <= Capacity);
+
+			uint16_t last = (uint16_t)(address + size - 1);
+
+			data_[size_++] = (uint8_t)(size + 2);
+			data_[size_++] = (uint8_t)((last >> 8) & 0x7F);
+			data_[size_++] = (uint8_t)(last & 0xFF);
+
+			for(size_t i = size; i > 0; --i)
+				data_[size_++] = data[i - 1];
+
+			return *this;
+		}
+
+		// Append a soft reset
+		constexpr LMX2492Image& Reset()
+		{
+			const uint8_t rst[1] = { LMX2492_SWRST_RESET };
+			return Write(LMX2492_SWRST_ADDR, rst, 1);
+		}
+
+		// Append a power configuration write
+		constexpr LMX2492Image& PowerConfig(uint8_t power_config)
+		{
+			assert(power_config <= 2);
+
+			const uint8_t pwr[1] = { power_config };
+			return Write(LMX2492_POWERDOWN_ADDR, pwr, 1);
+		}
+
+		// Encoded frames
+		constexpr const uint8_t* Data() const { return data_; }
+
+		// Size of the encoded frames in bytes
+		constexpr size_t Size() const { return size_; }
+
+	private:
+		uint8_t data_[Capacity];
+		size_t size_;
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_PLAN_H_ */
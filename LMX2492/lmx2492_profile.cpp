@@ -0,0 +1,283 @@
+/*
+ * lmx2492_profile.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_profile.h>
+
+#include <assert.h>
+#include "string.h"
+
+namespace bsp {
+
+// Offset of the index and of the frequency order for count profiles
+#define PROFILE_INDEX_OFFSET		sizeof(LMX2492_Profile_Header_TypeDef)
+#define PROFILE_ORDER_OFFSET(count)	(PROFILE_INDEX_OFFSET + (count) * sizeof(LMX2492_Profile_Entry_TypeDef))
+// Offset of the first profile
+#define PROFILE_DATA_OFFSET(count)	((PROFILE_ORDER_OFFSET(count) + (count) * sizeof(uint16_t) + LMX2492_PROFILE_ALIGN - 1) & ~(size_t)(LMX2492_PROFILE_ALIGN - 1))
+
+uint32_t LMX2492Crc32(const uint8_t *data, size_t size, uint32_t crc)
+{
+	// Reflected polynomial 0x04C11DB7, one nibble per step
+	static const uint32_t table[16] = {
+		0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+		0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+	};
+
+	crc = ~crc;
+
+	for(size_t i = 0; i < size; ++i)
+	{
+		crc ^= data[i];
+		crc = (crc >> 4) ^ table[crc & 0x0F];
+		crc = (crc >> 4) ^ table[crc & 0x0F];
+	}
+
+	return ~crc;
+}
+
+LMX2492ProfileLibrary::LMX2492ProfileLibrary()
+ : data_(NULL), header_(NULL), entries_(NULL), order_(NULL)
+{
+}
+
+bool LMX2492ProfileLibrary::Open(const uint8_t *data, size_t size)
+{
+	assert(data != NULL);
+
+	data_ = NULL;
+	header_ = NULL;
+	entries_ = NULL;
+	order_ = NULL;
+
+	const LMX2492_Profile_Header_TypeDef *header = (const LMX2492_Profile_Header_TypeDef*)data;
+
+	// Header and index are accessed in place
+	if(((uintptr_t)data % LMX2492_PROFILE_ALIGN) != 0) return false;
+	if(size < sizeof(LMX2492_Profile_Header_TypeDef)) return false;
+	if((header->magic != LMX2492_PROFILE_MAGIC) || (header->version != LMX2492_PROFILE_VERSION)) return false;
+	if((header->size > size) || (header->size < PROFILE_DATA_OFFSET(header->count))) return false;
+
+	if(LMX2492Crc32(data + PROFILE_INDEX_OFFSET, header->size - PROFILE_INDEX_OFFSET) != header->crc) return false;
+
+	const LMX2492_Profile_Entry_TypeDef *entries = (const LMX2492_Profile_Entry_TypeDef*)(data + PROFILE_INDEX_OFFSET);
+
+	for(size_t i = 0; i < header->count; ++i)
+	{
+		if((entries[i].offset < PROFILE_DATA_OFFSET(header->count)) || (entries[i].size > header->size - entries[i].offset))
+			return false;
+	}
+
+	data_ = data;
+	header_ = header;
+	entries_ = entries;
+	order_ = (const uint16_t*)(data + PROFILE_ORDER_OFFSET(header->count));
+
+	return true;
+}
+
+size_t LMX2492ProfileLibrary::Count() const
+{
+	return (header_ != NULL) ? header_->count : 0;
+}
+
+const LMX2492_Profile_Entry_TypeDef* LMX2492ProfileLibrary::Entry(size_t index) const
+{
+	assert(index < Count());
+
+	return &entries_[index];
+}
+
+bool LMX2492ProfileLibrary::FindById(uint32_t id, size_t &index) const
+{
+	size_t low = 0;
+	size_t high = Count();
+
+	while(low < high)
+	{
+		size_t mid = low + (high - low) / 2;
+
+		if(entries_[mid].id < id)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	if((low == Count()) || (entries_[low].id != id)) return false;
+
+	index = low;
+
+	return true;
+}
+
+bool LMX2492ProfileLibrary::FindByFrequency(uint64_t frequency, size_t &index) const
+{
+	if(Count() == 0) return false;
+
+	// First profile at or above frequency
+	size_t low = 0;
+	size_t high = Count();
+
+	while(low < high)
+	{
+		size_t mid = low + (high - low) / 2;
+
+		if(entries_[order_[mid]].frequency < frequency)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	// Closer of both neighbours
+	if((low == Count()) || ((low > 0) && (frequency - entries_[order_[low - 1]].frequency < entries_[order_[low]].frequency - frequency)))
+		--low;
+
+	index = order_[low];
+
+	return true;
+}
+
+bool LMX2492ProfileLibrary::VerifyProfile(size_t index) const
+{
+	const LMX2492_Profile_Entry_TypeDef *entry = Entry(index);
+
+	return LMX2492Crc32(data_ + entry->offset, entry->size) == entry->crc;
+}
+
+LMX2492Sequence LMX2492ProfileLibrary::Sequence(size_t index) const
+{
+	const LMX2492_Profile_Entry_TypeDef *entry = Entry(index);
+
+	return LMX2492Sequence(data_ + entry->offset, entry->size, entry->frames);
+}
+
+bool LMX2492ProfileLibrary::Activate(LMX2492Driver *driver, size_t index) const
+{
+	assert(driver != NULL);
+
+	LMX2492Sequence sequence = Sequence(index);
+
+	return driver->WriteSequence(&sequence);
+}
+
+LMX2492ProfileBuilder::LMX2492ProfileBuilder(uint8_t *buffer, size_t capacity, uint16_t max_profiles)
+ : buffer_(buffer), capacity_(capacity), max_profiles_(max_profiles)
+{
+	assert(buffer != NULL);
+	assert(((uintptr_t)buffer % LMX2492_PROFILE_ALIGN) == 0);
+	assert(capacity >= PROFILE_DATA_OFFSET(max_profiles));
+
+	Clear();
+}
+
+void LMX2492ProfileBuilder::Clear()
+{
+	count_ = 0;
+	size_ = PROFILE_DATA_OFFSET(max_profiles_);
+	finished_ = false;
+}
+
+bool LMX2492ProfileBuilder::Add(uint32_t id, uint64_t frequency, const LMX2492Sequence *sequence)
+{
+	assert(sequence != NULL);
+
+	LMX2492_Profile_Entry_TypeDef *entries = Entries();
+
+	if(finished_ || (count_ >= max_profiles_)) return false;
+	if(size_ + sequence->Size() > capacity_) return false;
+	// Offsets and sizes are stored in 32 bit, the frame count in 16 bit
+	if((size_ + sequence->Size() > 0xFFFFFFFFUL) || (sequence->Count() > 0xFFFF)) return false;
+
+	for(uint16_t i = 0; i < count_; ++i)
+	{
+		if(entries[i].id == id) return false;
+	}
+
+	memcpy(&buffer_[size_], sequence->Data(), sequence->Size());
+
+	LMX2492_Profile_Entry_TypeDef *entry = &entries[count_++];
+
+	memset(entry, 0, sizeof(LMX2492_Profile_Entry_TypeDef));
+	entry->frequency = frequency;
+	entry->id = id;
+	entry->offset = (uint32_t)size_;
+	entry->size = (uint32_t)sequence->Size();
+	entry->frames = (uint16_t)sequence->Count();
+
+	size_ += sequence->Size();
+
+	return true;
+}
+
+size_t LMX2492ProfileBuilder::Finish()
+{
+	LMX2492_Profile_Entry_TypeDef *entries = Entries();
+
+	if(finished_) return size_;
+
+	// Move the profiles down to the index of count_ entries
+	size_t shift = PROFILE_DATA_OFFSET(max_profiles_) - PROFILE_DATA_OFFSET(count_);
+
+	memmove(&buffer_[PROFILE_DATA_OFFSET(count_)], &buffer_[PROFILE_DATA_OFFSET(max_profiles_)], size_ - PROFILE_DATA_OFFSET(max_profiles_));
+	size_ -= shift;
+
+	for(uint16_t i = 0; i < count_; ++i)
+	{
+		entries[i].offset -= (uint32_t)shift;
+		entries[i].crc = LMX2492Crc32(&buffer_[entries[i].offset], entries[i].size);
+	}
+
+	// Sort the index by id, insertion sort of a short table
+	for(uint16_t i = 1; i < count_; ++i)
+	{
+		LMX2492_Profile_Entry_TypeDef entry = entries[i];
+		uint16_t j = i;
+
+		for(; (j > 0) && (entries[j - 1].id > entry.id); --j)
+			entries[j] = entries[j - 1];
+
+		entries[j] = entry;
+	}
+
+	// Frequency order, stable for equal frequencies
+	uint16_t *order = (uint16_t*)&buffer_[PROFILE_ORDER_OFFSET(count_)];
+
+	for(uint16_t i = 0; i < count_; ++i)
+	{
+		uint16_t j = i;
+
+		for(; (j > 0) && (entries[order[j - 1]].frequency > entries[i].frequency); --j)
+			order[j] = order[j - 1];
+
+		order[j] = i;
+	}
+
+	// Padding in front of the first profile
+	memset(&order[count_], 0, PROFILE_DATA_OFFSET(count_) - PROFILE_ORDER_OFFSET(count_) - count_ * sizeof(uint16_t));
+
+	LMX2492_Profile_Header_TypeDef *header = (LMX2492_Profile_Header_TypeDef*)buffer_;
+
+	header->magic = LMX2492_PROFILE_MAGIC;
+	header->version = LMX2492_PROFILE_VERSION;
+	header->count = count_;
+	header->size = (uint32_t)size_;
+	header->crc = LMX2492Crc32(&buffer_[PROFILE_INDEX_OFFSET], size_ - PROFILE_INDEX_OFFSET);
+
+	finished_ = true;
+
+	return size_;
+}
+
+size_t LMX2492ProfileBuilder::Count() const
+{
+	return count_;
+}
+
+LMX2492_Profile_Entry_TypeDef* LMX2492ProfileBuilder::Entries() const
+{
+	return (LMX2492_Profile_Entry_TypeDef*)&buffer_[PROFILE_INDEX_OFFSET];
+}
+
+} /* namespace bsp */
@@ -0,0 +1,132 @@
+/*
+ * lmx2492_profile.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_PROFILE_H_
+#define LMX2492_PROFILE_H_
+
+#include <lmx2492_driver.h>
+#include <lmx2492_sequence.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Profile library format, little endian like the targets:
+//   Header		LMX2492_Profile_Header_TypeDef
+//   Index		LMX2492_Profile_Entry_TypeDef[count], sorted by id
+//   Order		uint16_t[count] entry indices sorted by frequency, padded to 8 bytes
+//   Profiles	encoded write frames (LMX2492Sequence format)
+// The header CRC covers all bytes after the header, each entry CRC its frames.
+// Profiles built by lmx2492_profile_tool are complete: the frames write every configuration
+// register (0x10 ... 0x27, 0x3A ... 0x8D), unset values at their POR value, so a profile
+// does not depend on the previously active one. POWERDOWN / SWRST (0x02) are only written if
+// the profile sets them. Profiles added from other recordings hold what was recorded.
+#define LMX2492_PROFILE_MAGIC		0x50584D4CUL	// "LMXP"
+#define LMX2492_PROFILE_VERSION		1
+#define LMX2492_PROFILE_ALIGN		8
+
+namespace bsp
+{
+
+	typedef struct {
+		uint32_t magic;			// LMX2492_PROFILE_MAGIC
+		uint16_t version;		// LMX2492_PROFILE_VERSION
+		uint16_t count;			// Number of profiles
+		uint32_t size;			// Library size in bytes, header included
+		uint32_t crc;			// CRC-32 of bytes 16 ... size - 1
+	} LMX2492_Profile_Header_TypeDef;
+
+	typedef struct {
+		uint64_t frequency;		// Output frequency in Hz, lookup key
+		uint32_t id;			// Profile id, lookup key
+		uint32_t offset;		// Frames, from the start of the library
+		uint32_t size;			// Size of the frames in bytes
+		uint32_t crc;			// CRC-32 of the frames
+		uint16_t frames;		// Number of frames
+		uint16_t reserved;
+		uint32_t reserved2;
+	} LMX2492_Profile_Entry_TypeDef;
+
+	static_assert(sizeof(LMX2492_Profile_Header_TypeDef) == 16, "LMX2492_Profile_Header_TypeDef layout");
+	static_assert(sizeof(LMX2492_Profile_Entry_TypeDef) == 32, "LMX2492_Profile_Entry_TypeDef layout");
+
+	// CRC-32 (IEEE 802.3), continue a running CRC by passing it as crc
+	uint32_t LMX2492Crc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+	// Read only view of a profile library, e.g. linked into flash. Profiles are replayed
+	// straight from the library without parsing or copying.
+	class LMX2492ProfileLibrary
+	{
+	public:
+		LMX2492ProfileLibrary();
+
+		// Check header, size and CRC of a library, data must be LMX2492_PROFILE_ALIGN aligned.
+		// Returns false and leaves the library empty if the library is invalid.
+		bool Open(const uint8_t* data, size_t size);
+
+		// Number of profiles
+		size_t Count() const;
+
+		// Index entry of a profile
+		const LMX2492_Profile_Entry_TypeDef* Entry(size_t index) const;
+
+		// Binary search of a profile by id
+		bool FindById(uint32_t id, size_t& index) const;
+
+		// Binary search of the profile closest to frequency (Hz)
+		bool FindByFrequency(uint64_t frequency, size_t& index) const;
+
+		// Check the CRC of a profile, e.g. before activating it
+		bool VerifyProfile(size_t index) const;
+
+		// Read only sequence of the profile frames in the library, for LMX2492Driver::Replay()
+		LMX2492Sequence Sequence(size_t index) const;
+
+		// Write a profile with blocking transfers, the driver's shadow is updated
+		bool Activate(LMX2492Driver* driver, size_t index) const;
+
+	private:
+		const uint8_t* data_;
+		const LMX2492_Profile_Header_TypeDef* header_;
+		const LMX2492_Profile_Entry_TypeDef* entries_;
+		const uint16_t* order_;
+	};
+
+	// Builds a profile library into a user provided buffer, on a host (see Tools) or on the target
+	class LMX2492ProfileBuilder
+	{
+	public:
+		// The index is reserved for up to max_profiles, buffer must be LMX2492_PROFILE_ALIGN aligned
+		LMX2492ProfileBuilder(uint8_t* buffer, size_t capacity, uint16_t max_profiles);
+
+		// Remove all profiles
+		void Clear();
+
+		// Add the frames of a recorded sequence as profile.
+		// Returns false if the id exists, the buffer or the index is full or the library is finished.
+		bool Add(uint32_t id, uint64_t frequency, const LMX2492Sequence* sequence);
+
+		// Sort the index, compact the library and write the CRCs and the header.
+		// Returns the library size, Clear() before adding profiles again.
+		size_t Finish();
+
+		// Number of profiles
+		size_t Count() const;
+
+	private:
+		uint8_t* buffer_;
+		size_t capacity_;
+		uint16_t max_profiles_;
+		uint16_t count_;
+		size_t size_;
+		bool finished_;
+
+		// Entries in the reserved index
+		LMX2492_Profile_Entry_TypeDef* Entries() const;
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_PROFILE_H_ */
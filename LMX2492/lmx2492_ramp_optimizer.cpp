@@ -0,0 +1,167 @@
+/*
+ * lmx2492_ramp_optimizer.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_ramp_optimizer.h>
+#include <lmx2492_driver.h>
+#include <lmx2492_plan.h>
+
+#include <assert.h>
+#include "string.h"
+
+namespace bsp {
+
+static inline uint64_t abs64(int64_t x)
+{
+	return (uint64_t)((x < 0) ? -x : x);
+}
+
+LMX2492RampOptimizer::LMX2492RampOptimizer(uint32_t fref, uint16_t R, uint8_t OSC_2X)
+ : fref_(fref), R_(R), osc_2x_(OSC_2X), delay_(true), max_step_(0), mod_count_(0)
+{
+	assert(fref > 0);
+	assert(R > 0);
+	assert(OSC_2X <= 0x1);
+	assert((uint64_t)fref * (OSC_2X + 1) <= 0x7FFFFFFF);
+}
+
+void LMX2492RampOptimizer::SetModClocks(const uint32_t *rates, size_t count)
+{
+	assert((rates != NULL) || (count == 0));
+	assert(count <= LMX2492_RAMP_OPT_MAX_CLOCKS);
+
+	for(size_t i = 0; i < count; ++i)
+		assert((rates[i] > 0) && (rates[i] <= 0x7FFFFFFF));
+
+	memcpy(mod_clocks_, rates, count * sizeof(uint32_t));
+	mod_count_ = count;
+}
+
+void LMX2492RampOptimizer::SetDelay(bool allow)
+{
+	delay_ = allow;
+}
+
+void LMX2492RampOptimizer::SetMaxStep(uint64_t step)
+{
+	max_step_ = step;
+}
+
+void LMX2492RampOptimizer::Search(int64_t df, uint32_t duration, uint64_t clk_num, uint64_t clk_den, uint8_t DLY, uint8_t RAMP_CLK, uint32_t fmod,
+		LMX2492_Ramp_Solution_TypeDef *solution, uint64_t &best) const
+{
+	uint64_t D = (uint64_t)fref_ * (osc_2x_ + 1);
+	uint64_t mag = abs64(df);
+
+	// LEN = duration * finc rounded, finc = clk_num / clk_den
+	uint64_t div = clk_den * 1000000000ULL;
+	uint64_t target = (uint64_t)duration * clk_num;
+	uint64_t center = (target + div / 2) / div;
+
+	for(int32_t d = -LMX2492_RAMP_OPT_WINDOW; d <= LMX2492_RAMP_OPT_WINDOW; ++d)
+	{
+		int64_t len = (int64_t)center + d;
+		if((len < 1) || (len > 0xFFFF)) continue;
+
+		// Duration error in ps from the time difference in 1 / clk_num ns
+		uint64_t achieved_time = (uint64_t)len * div;
+		uint64_t diff = (achieved_time >= target) ? achieved_time - target : target - achieved_time;
+		uint64_t dt_mag = (diff / clk_num) * 1000 + ((diff % clk_num) * 1000) / clk_num;
+		int64_t dt = (achieved_time >= target) ? (int64_t)dt_mag : -(int64_t)dt_mag;
+
+		// ppb = dt[ps] * 10^6 / duration[ns]
+		int64_t duration_error = (int64_t)((dt_mag / duration) * 1000000 + ((dt_mag % duration) * 1000000) / duration);
+		if(dt < 0) duration_error = -duration_error;
+
+		// LEN further off the duration can not win
+		if(abs64(duration_error) >= best) continue;
+
+		// Frequency step per increment
+		if((max_step_ != 0) && (mag > max_step_ * (uint64_t)len)) continue;
+
+		// INC = df / fPFD * 2^24 / LEN, must fit the 30 bit two's complement register
+		if((mag * R_) / (D * len) >= 32) continue;
+
+		uint64_t inc = LMX2492Plan::ScaleFrac24(mag * R_, D * len);
+		if(inc > 0x1FFFFFFF) continue;
+
+		uint32_t INC = (uint32_t)((df < 0) ? ((0x40000000 - inc) & 0x3FFFFFFF) : inc);
+
+		int64_t achieved = LMX2492Driver::RampDeltaHz(INC, (uint32_t)len, fref_, R_, osc_2x_);
+		int64_t df_error = (df != 0) ? (achieved - df * 1000) * 1000000 / df : 0;
+
+		uint64_t cost = abs64(df_error) + abs64(duration_error);
+		if(cost >= best) continue;
+
+		best = cost;
+
+		solution->INC = INC;
+		solution->LEN = (uint16_t)len;
+		solution->DLY = DLY;
+		solution->RAMP_CLK = RAMP_CLK;
+		solution->fmod = fmod;
+		solution->df = achieved;
+		solution->duration = (uint64_t)duration * 1000 + dt;
+		solution->df_error = df_error;
+		solution->duration_error = duration_error;
+		// (1 + e_df) / (1 + e_t) - 1
+		solution->slope_error = (df_error - duration_error) * 1000000000 / (1000000000 + duration_error);
+	}
+}
+
+bool LMX2492RampOptimizer::Optimize(int64_t df, uint32_t duration, LMX2492_Ramp_Solution_TypeDef *solution) const
+{
+	assert(solution != NULL);
+	assert(duration > 0);
+
+	memset(solution, 0, sizeof(LMX2492_Ramp_Solution_TypeDef));
+
+	uint64_t best = UINT64_MAX;
+	uint64_t D = (uint64_t)fref_ * (osc_2x_ + 1);
+
+	// Phase detector clock, one or two cycles per increment
+	Search(df, duration, D, R_, LMX2492_RAMPx_DLY_1PFD, LMX2492_RAMP_CLK_PD, 0, solution, best);
+
+	if(delay_)
+		Search(df, duration, D, 2 * (uint64_t)R_, LMX2492_RAMPx_DLY_2PFD, LMX2492_RAMP_CLK_PD, 0, solution, best);
+
+	// MOD pin clocks
+	for(size_t i = 0; i < mod_count_; ++i)
+	{
+		Search(df, duration, mod_clocks_[i], 1, LMX2492_RAMPx_DLY_1PFD, LMX2492_RAMP_CLK_MOD, mod_clocks_[i], solution, best);
+
+		if(delay_)
+			Search(df, duration, mod_clocks_[i], 2, LMX2492_RAMPx_DLY_2PFD, LMX2492_RAMP_CLK_MOD, mod_clocks_[i], solution, best);
+	}
+
+	return solution->LEN != 0;
+}
+
+size_t LMX2492RampOptimizer::OptimizeBatch(const LMX2492_Ramp_Target_TypeDef *targets, size_t count, LMX2492_Ramp_Solution_TypeDef *solutions) const
+{
+	assert(targets != NULL);
+	assert(solutions != NULL);
+
+	size_t solved = 0;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		if(Optimize(targets[i].df, targets[i].duration, &solutions[i]))
+			++solved;
+	}
+
+	return solved;
+}
+
+void LMX2492RampOptimizer::SimpleRamp(LMX2492_Ramp_TypeDef *ramp, const LMX2492_Ramp_Solution_TypeDef *solution, uint8_t RAMP_NEXT, uint8_t RAMP_RST, uint8_t RAMP_NEXT_TRIG)
+{
+	assert(solution != NULL);
+	assert(solution->LEN != 0);
+
+	LMX2492Driver::SimpleRamp(ramp, solution->INC, solution->LEN, RAMP_NEXT, RAMP_RST, RAMP_NEXT_TRIG, solution->DLY);
+}
+
+} /* namespace bsp */
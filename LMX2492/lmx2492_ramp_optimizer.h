@@ -0,0 +1,86 @@
+/*
+ * lmx2492_ramp_optimizer.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_RAMP_OPTIMIZER_H_
+#define LMX2492_RAMP_OPTIMIZER_H_
+
+#include <lmx2492_regdef.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Max. number of MOD pin clock rates to search
+#define LMX2492_RAMP_OPT_MAX_CLOCKS		16
+
+// LEN values searched on each side of the rounded duration
+#define LMX2492_RAMP_OPT_WINDOW			64
+
+namespace bsp
+{
+
+	// Intended ramp
+	typedef struct {
+		int64_t df;				// Frequency delta in Hz, may be negative
+		uint32_t duration;		// Duration in ns
+	} LMX2492_Ramp_Target_TypeDef;
+
+	// Achievable ramp closest to a target
+	typedef struct {
+		uint32_t INC;			// 30 bit two's complement
+		uint16_t LEN;			// 0 if the target is not achievable
+		uint8_t DLY;			// LMX2492_RAMPx_DLY_1PFD / LMX2492_RAMPx_DLY_2PFD
+		uint8_t RAMP_CLK;		// LMX2492_RAMP_CLK_PD / LMX2492_RAMP_CLK_MOD
+		uint32_t fmod;			// MOD pin clock in Hz with RAMP_CLK_MOD
+		int64_t df;				// Achieved frequency delta in mHz
+		uint64_t duration;		// Achieved duration in ps
+		int64_t df_error;		// Relative frequency delta error in ppb
+		int64_t duration_error;	// Relative duration error in ppb
+		int64_t slope_error;	// Relative slope error in ppb
+	} LMX2492_Ramp_Solution_TypeDef;
+
+	// Joint search of LEN, INC, RAMPx_DLY and the ramp clock for the ramp closest to a target.
+	// Minimizes the sum of the relative frequency delta and duration errors.
+	class LMX2492RampOptimizer
+	{
+	public:
+		LMX2492RampOptimizer(uint32_t fref, uint16_t R = 1, uint8_t OSC_2X = 0);
+
+		// MOD pin clock rates in Hz that may be used as ramp clock, none by default
+		void SetModClocks(const uint32_t* rates, size_t count);
+
+		// Allow ramps with two clock cycles per increment (RAMPx_DLY)
+		void SetDelay(bool allow);
+
+		// Max. frequency step per increment in Hz, limits the staircase of slow ramp clocks (0 for no limit)
+		void SetMaxStep(uint64_t step);
+
+		// Find the closest achievable ramp, returns false if no clock can reach the target
+		bool Optimize(int64_t df, uint32_t duration, LMX2492_Ramp_Solution_TypeDef* solution) const;
+
+		// Optimize many targets, returns the number of achievable targets
+		size_t OptimizeBatch(const LMX2492_Ramp_Target_TypeDef* targets, size_t count, LMX2492_Ramp_Solution_TypeDef* solutions) const;
+
+		// Write a solution to a ramp slot
+		static void SimpleRamp(LMX2492_Ramp_TypeDef* ramp, const LMX2492_Ramp_Solution_TypeDef* solution, uint8_t RAMP_NEXT = 0, uint8_t RAMP_RST = LMX2492_RAMPx_RST_DISABLE, uint8_t RAMP_NEXT_TRIG = LMX2492_RAMPx_NEXT_TRIG_NONE);
+
+	private:
+		uint32_t fref_;
+		uint16_t R_;
+		uint8_t osc_2x_;
+		bool delay_;
+		uint64_t max_step_;
+
+		uint32_t mod_clocks_[LMX2492_RAMP_OPT_MAX_CLOCKS];
+		size_t mod_count_;
+
+		// Search LEN around the rounded duration for ramp clock clk_num / clk_den, keep the best in solution
+		void Search(int64_t df, uint32_t duration, uint64_t clk_num, uint64_t clk_den, uint8_t DLY, uint8_t RAMP_CLK, uint32_t fmod,
+				LMX2492_Ramp_Solution_TypeDef* solution, uint64_t& best) const;
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_RAMP_OPTIMIZER_H_ */
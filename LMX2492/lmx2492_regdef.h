@@ -12,6 +12,11 @@
 
 namespace bsp {
 
+////////////////////////////////////////////////////////////////////////////
+// LMX2492 register map 0x00 ... 0x8D
+#define LMX2492_LAST_ADDRESS		0x8D
+#define LMX2492_REGISTER_COUNT		(LMX2492_LAST_ADDRESS + 1)
+
 ////////////////////////////////////////////////////////////////////////////
 // LMX2492 revision ID register, POR value = 0x18
 #define LMX2492_ID_ADDR			0x00
@@ -87,6 +92,12 @@ typedef struct {
 #define LMX2492_CONFIG_ADDRESS	0x10
 #define LMX2492_CONFIG_LAST_ADDRESS	(LMX2492_CONFIG_ADDRESS + sizeof(LMX2492_Config_TypeDef) - 1)
 
+// PLL_N (upper bytes), FRAC_NUM and FRAC_DEN are double buffered and
+// take effect on the next write of PLL_N[7:0]
+#define LMX2492_PLL_LATCH_ADDR				0x10
+#define LMX2492_PLL_BUFFERED_ADDRESS		0x11
+#define LMX2492_PLL_BUFFERED_LAST_ADDRESS	0x18
+
 // FRAC_ORDER register
 // Values
 #define LMX2492_FRAC_ORDER_INTEGER 	0
@@ -307,6 +318,13 @@ typedef struct {
 #define LMX2492_RAMP_PM_EN_FM		0
 #define LMX2492_RAMP_PM_EN_PM		1
 
+// FSK_TRIG register
+// State defines:
+#define LMX2492_FSK_TRIG_DISABLED	0
+#define LMX2492_FSK_TRIG_A			1
+#define LMX2492_FSK_TRIG_B			2
+#define LMX2492_FSK_TRIG_C			3
+
 ////////////////////////////////////////////////////////////////////////////
 // Single ramp registers and definitions
 typedef struct {
@@ -330,6 +348,9 @@ typedef struct {
 #define LMX2492_RAMP_ADDRESS(x) 		(0x56 + (sizeof(LMX2492_Ramp_TypeDef) * (x)))
 #define LMX2492_RAMP_LAST_ADDRESS(x) 	(LMX2492_RAMP_ADDRESS(x) + sizeof(LMX2492_Ramp_TypeDef) - 1)
 
+// Number of ramp slots, all slots occupy 0x56 ... 0x8D
+#define LMX2492_RAMP_COUNT				8
+
 // RAMP0_FL register
 // State defines:
 #define LMX2492_RAMPx_FL_DISABLE	0
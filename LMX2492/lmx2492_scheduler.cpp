@@ -0,0 +1,177 @@
+/*
+ * lmx2492_scheduler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_scheduler.h>
+
+#include <assert.h>
+
+namespace bsp {
+
+LMX2492Scheduler::LMX2492Scheduler(LMX2492_Job_TypeDef *jobs, size_t capacity)
+ : jobs_(jobs), capacity_(capacity), count_(0)
+{
+	assert(jobs != NULL);
+	assert(capacity < LMX2492_JOB_NONE);
+}
+
+void LMX2492Scheduler::Clear()
+{
+	count_ = 0;
+}
+
+bool LMX2492Scheduler::AddCommit(LMX2492Driver *driver, LMX2492Sequence *sequence)
+{
+	assert(driver != NULL);
+	assert(sequence != NULL);
+
+	if(count_ >= capacity_) return false;
+
+	sequence->Clear();
+
+	driver->BeginRecord(sequence);
+	bool success = driver->Commit();
+	success &= driver->EndRecord();
+
+	if(!success) return false;
+
+	// Device up to date
+	if(sequence->Count() == 0) return true;
+
+	return Add(driver, sequence);
+}
+
+bool LMX2492Scheduler::Add(LMX2492Driver *driver, const LMX2492Sequence *sequence)
+{
+	assert(driver != NULL);
+	assert(sequence != NULL);
+
+	if(count_ >= capacity_) return false;
+
+	LMX2492_Job_TypeDef *job = &jobs_[count_];
+
+	job->driver = driver;
+	job->sequence = sequence;
+	job->scheduler = this;
+	job->next = LMX2492_JOB_NONE;
+	job->first = 1;
+	job->state = LMX2492_JOB_PENDING;
+
+	// Append to the chain of the bus
+	for(size_t i = 0; i < count_; ++i)
+	{
+		if((jobs_[i].next == LMX2492_JOB_NONE) && jobs_[i].driver->SpiSameBus(driver))
+		{
+			jobs_[i].next = (uint16_t)count_;
+			job->first = 0;
+			break;
+		}
+	}
+
+	++count_;
+
+	return true;
+}
+
+bool LMX2492Scheduler::Start()
+{
+	if(count_ == 0) return true;
+
+	for(size_t i = 0; i < count_; ++i)
+	{
+		if(jobs_[i].state == LMX2492_JOB_RUNNING) return false;
+
+		jobs_[i].state = LMX2492_JOB_PENDING;
+	}
+
+	// Register images are updated here, jobs are started from the complete interrupts
+	for(size_t i = 0; i < count_; ++i)
+		jobs_[i].driver->StageSequence(jobs_[i].sequence);
+
+	// Buses run independently, each chain continues from its complete interrupt
+	for(size_t i = 0; i < count_; ++i)
+	{
+		if(jobs_[i].first)
+			StartChain((uint16_t)i);
+	}
+
+	return Failures() < count_;
+}
+
+void LMX2492Scheduler::StartChain(uint16_t index)
+{
+	while(index != LMX2492_JOB_NONE)
+	{
+		LMX2492_Job_TypeDef *job = &jobs_[index];
+
+		job->state = LMX2492_JOB_RUNNING;
+
+		// Continued from the complete callback once started
+		if(job->driver->StartReplay(job->sequence, &LMX2492Scheduler::JobComplete, job))
+			return;
+
+		job->state = LMX2492_JOB_FAILED;
+		index = job->next;
+	}
+}
+
+void LMX2492Scheduler::JobComplete(void *context, bool success)
+{
+	LMX2492_Job_TypeDef *job = (LMX2492_Job_TypeDef*)context;
+
+	job->state = success ? LMX2492_JOB_DONE : LMX2492_JOB_FAILED;
+
+	// Bus is released before the callback, continue with the next job
+	job->scheduler->StartChain(job->next);
+}
+
+bool LMX2492Scheduler::Done() const
+{
+	for(size_t i = 0; i < count_; ++i)
+	{
+		if(jobs_[i].state < LMX2492_JOB_DONE)
+			return false;
+	}
+
+	return true;
+}
+
+bool LMX2492Scheduler::Run()
+{
+	if(!Start()) return false;
+
+	// Transfers complete in interrupt context
+	while(!Done()) { }
+
+	return Failures() == 0;
+}
+
+size_t LMX2492Scheduler::Count() const
+{
+	return count_;
+}
+
+size_t LMX2492Scheduler::Failures() const
+{
+	size_t failures = 0;
+
+	for(size_t i = 0; i < count_; ++i)
+	{
+		if(jobs_[i].state == LMX2492_JOB_FAILED)
+			++failures;
+	}
+
+	return failures;
+}
+
+uint8_t LMX2492Scheduler::State(size_t index) const
+{
+	assert(index < count_);
+
+	return jobs_[index].state;
+}
+
+} /* namespace bsp */
@@ -0,0 +1,94 @@
+/*
+ * lmx2492_scheduler.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_SCHEDULER_H_
+#define LMX2492_SCHEDULER_H_
+
+#include <lmx2492_driver.h>
+#include <lmx2492_sequence.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Job states
+#define LMX2492_JOB_PENDING		0
+#define LMX2492_JOB_RUNNING		1
+#define LMX2492_JOB_DONE		2
+#define LMX2492_JOB_FAILED		3
+
+// No following job on the bus
+#define LMX2492_JOB_NONE		0xFFFF
+
+namespace bsp
+{
+
+	class LMX2492Scheduler;
+
+	// Replay of a sequence by a driver
+	typedef struct {
+		LMX2492Driver* driver;
+		const LMX2492Sequence* sequence;
+		LMX2492Scheduler* scheduler;
+		uint16_t next;				// Next job on the same bus
+		uint8_t first;				// First job on its bus
+		volatile uint8_t state;		// LMX2492_JOB_*
+	} LMX2492_Job_TypeDef;
+
+	// Programs drivers on separate SPI peripherals in parallel. Jobs are replayed by
+	// chained DMA (LMX2492Driver::Replay), jobs on the same bus one after another, each
+	// started from the complete interrupt of the previous one. The total time is the one
+	// of the busiest bus. The Linux backend transfers synchronously, jobs run in sequence there.
+	class LMX2492Scheduler
+	{
+	public:
+		// Jobs stored in a user provided array, e.g. a static array
+		LMX2492Scheduler(LMX2492_Job_TypeDef* jobs, size_t capacity);
+
+		// Remove all jobs, no job may be running
+		void Clear();
+
+		// Record the staged changes of driver (see LMX2492Driver::Commit) into sequence and add
+		// them as a job. Nothing is added if no byte is dirty. The shadow is updated when the job is done.
+		// Returns false if the table or the sequence is full.
+		bool AddCommit(LMX2492Driver* driver, LMX2492Sequence* sequence);
+
+		// Add a recorded sequence as a job, it must stay valid until the job is done
+		bool Add(LMX2492Driver* driver, const LMX2492Sequence* sequence);
+
+		// Start the first job of every bus and return immediately.
+		// Returns false if a job is running or no job could be started.
+		bool Start();
+
+		// Returns true when all jobs are done or failed
+		bool Done() const;
+
+		// Start all jobs and wait until they are finished, returns true if all succeeded
+		bool Run();
+
+		// Number of jobs
+		size_t Count() const;
+
+		// Number of failed jobs
+		size_t Failures() const;
+
+		// State of a job (LMX2492_JOB_*)
+		uint8_t State(size_t index) const;
+
+	private:
+		LMX2492_Job_TypeDef* jobs_;
+		size_t capacity_;
+		size_t count_;
+
+		// Start the job index or, if it can not be started, the following ones on its bus
+		void StartChain(uint16_t index);
+
+		// Replay complete callback, starts the next job on the bus
+		static void JobComplete(void* context, bool success);
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_SCHEDULER_H_ */
@@ -0,0 +1,87 @@
+/*
+ * lmx2492_sequence.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_sequence.h>
+#include <lmx2492_driver.h>
+
+#include <assert.h>
+#include "string.h"
+
+namespace bsp {
+
+LMX2492Sequence::LMX2492Sequence(uint8_t *buffer, size_t capacity)
+ : buffer_(buffer), capacity_(capacity), size_(0), count_(0)
+{
+	assert(buffer != NULL);
+}
+
+LMX2492Sequence::LMX2492Sequence(const uint8_t *frames, size_t size)
+ : buffer_(const_cast<uint8_t*>(frames)), capacity_(0), size_(size), count_(0)
+{
+	assert(frames != NULL);
+
+	// Count frames, Append() always fails without capacity
+	for(size_t i = 0; i < size; i += frames[i] + 1)
+		++count_;
+}
+
+LMX2492Sequence::LMX2492Sequence(const uint8_t *frames, size_t size, size_t count)
+ : buffer_(const_cast<uint8_t*>(frames)), capacity_(0), size_(size), count_(count)
+{
+	assert(frames != NULL);
+}
+
+void LMX2492Sequence::Clear()
+{
+	size_ = 0;
+	count_ = 0;
+}
+
+bool LMX2492Sequence::Append(uint16_t address, const uint8_t *data, size_t size)
+{
+	// Length byte, header and data
+	if(size_ + 1 + LMX2492_FRAME_HEADER_SIZE + size > capacity_) return false;
+
+	buffer_[size_] = (uint8_t)LMX2492Driver::EncodeFrame(address, data, size, &buffer_[size_ + 1]);
+	size_ += buffer_[size_] + 1;
+	++count_;
+
+	return true;
+}
+
+bool LMX2492Sequence::AppendFrame(const uint8_t *frame, size_t size)
+{
+	assert(frame != NULL);
+	assert(size > LMX2492_FRAME_HEADER_SIZE);
+
+	// Length byte and frame
+	if(size_ + 1 + size > capacity_) return false;
+
+	buffer_[size_] = (uint8_t)size;
+	memcpy(&buffer_[size_ + 1], frame, size);
+	size_ += size + 1;
+	++count_;
+
+	return true;
+}
+
+const uint8_t* LMX2492Sequence::Data() const
+{
+	return buffer_;
+}
+
+size_t LMX2492Sequence::Size() const
+{
+	return size_;
+}
+
+size_t LMX2492Sequence::Count() const
+{
+	return count_;
+}
+
+} /* namespace bsp */
@@ -0,0 +1,61 @@
+/*
+ * lmx2492_sequence.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_SEQUENCE_H_
+#define LMX2492_SEQUENCE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace bsp
+{
+
+	// Recorded list of PLL register writes, replayed as one chained DMA transfer.
+	// Frames are stored ready to transmit: a length byte followed by the 16 bit
+	// address header and the data in descending address order.
+	class LMX2492Sequence
+	{
+	public:
+		// Sequence stored in a user provided buffer, e.g. a static array
+		LMX2492Sequence(uint8_t* buffer, size_t capacity);
+
+		// Read only sequence of already encoded frames, e.g. a LMX2492Image in flash
+		LMX2492Sequence(const uint8_t* frames, size_t size);
+
+		// Read only sequence with a known number of frames, the frames are not walked
+		LMX2492Sequence(const uint8_t* frames, size_t size, size_t count);
+
+		// Remove all frames
+		void Clear();
+
+		// Append a write frame for data starting at address.
+		// Returns false if the buffer is full.
+		bool Append(uint16_t address, const uint8_t* data, size_t size);
+
+		// Append an already encoded write frame.
+		// Returns false if the buffer is full.
+		bool AppendFrame(const uint8_t* frame, size_t size);
+
+		// Encoded frames
+		const uint8_t* Data() const;
+
+		// Size of the encoded frames in bytes
+		size_t Size() const;
+
+		// Number of frames
+		size_t Count() const;
+
+	private:
+		uint8_t* buffer_;
+		size_t capacity_;
+		size_t size_;
+		size_t count_;
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_SEQUENCE_H_ */
@@ -0,0 +1,183 @@
+/*
+ * lmx2492_trace.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_trace.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include "string.h"
+
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+#define LMX2492_TRACE_HOST
+#include <chrono>
+#else
+// Target definition in main.h file generated by CubeMX
+#include "main.h"
+#endif
+
+namespace bsp {
+
+LMX2492Trace::LMX2492Trace(LMX2492_Trace_Record_TypeDef *buffer, size_t capacity)
+ : buffer_(buffer), mask_(capacity - 1), head_(0), tail_(0), dropped_(0)
+{
+	assert(buffer != NULL);
+	assert((capacity > 0) && ((capacity & (capacity - 1)) == 0));
+
+	memset(stats_, 0, sizeof(stats_));
+}
+
+void LMX2492Trace::Log(const LMX2492_Trace_Record_TypeDef *record)
+{
+	assert(record->op < LMX2492_TRACE_OP_COUNT);
+
+	// Statistics
+	LMX2492_Trace_Stats_TypeDef *stats = &stats_[record->op];
+	uint32_t ticks = record->end - record->start;
+	uint8_t bucket = 0;
+
+	for(uint32_t t = ticks; (t > 1) && (bucket < LMX2492_TRACE_BUCKETS - 1); t >>= 1)
+		++bucket;
+
+	++stats->count;
+	stats->failures += record->result ? 0 : 1;
+	stats->bytes += record->size;
+	stats->ticks += ticks;
+	++stats->histogram[bucket];
+
+	if(ticks > stats->ticks_max)
+		stats->ticks_max = ticks;
+
+	// Record, only the producer writes head_
+	uint32_t head = head_.load(std::memory_order_relaxed);
+
+	if(head - tail_.load(std::memory_order_acquire) > mask_)
+	{
+		++dropped_;
+		return;
+	}
+
+	buffer_[head & mask_] = *record;
+	head_.store(head + 1, std::memory_order_release);
+}
+
+bool LMX2492Trace::Read(LMX2492_Trace_Record_TypeDef *record)
+{
+	assert(record != NULL);
+
+	// Only the consumer writes tail_
+	uint32_t tail = tail_.load(std::memory_order_relaxed);
+
+	if(tail == head_.load(std::memory_order_acquire))
+		return false;
+
+	*record = buffer_[tail & mask_];
+	tail_.store(tail + 1, std::memory_order_release);
+
+	return true;
+}
+
+const LMX2492_Trace_Stats_TypeDef* LMX2492Trace::Stats(uint8_t op) const
+{
+	assert(op < LMX2492_TRACE_OP_COUNT);
+
+	return &stats_[op];
+}
+
+uint32_t LMX2492Trace::Dropped() const
+{
+	return dropped_;
+}
+
+void LMX2492Trace::Clear()
+{
+	tail_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+	dropped_ = 0;
+	memset(stats_, 0, sizeof(stats_));
+}
+
+size_t LMX2492Trace::Dump(char *buffer, size_t size) const
+{
+	assert(buffer != NULL);
+	assert(size > 0);
+
+	static const char *names[LMX2492_TRACE_OP_COUNT] = { "write", "read", "write_async", "replay" };
+	size_t length = 0;
+
+	for(uint8_t op = 0; op < LMX2492_TRACE_OP_COUNT; ++op)
+	{
+		const LMX2492_Trace_Stats_TypeDef *s = &stats_[op];
+
+		if(length < size)
+			length += snprintf(&buffer[length], size - length, "%s,%lu,%lu,%llu,%llu,%lu", names[op], (unsigned long)s->count,
+					(unsigned long)s->failures, (unsigned long long)s->bytes, (unsigned long long)s->ticks, (unsigned long)s->ticks_max);
+
+		for(uint8_t i = 0; (i < LMX2492_TRACE_BUCKETS) && (length < size); ++i)
+			length += snprintf(&buffer[length], size - length, ",%lu", (unsigned long)s->histogram[i]);
+
+		if(length < size)
+			length += snprintf(&buffer[length], size - length, "\n");
+	}
+
+	return (length < size) ? length : size - 1;
+}
+
+#ifdef LMX2492_TRACE_HOST
+
+void LMX2492Trace::Start() { }
+
+uint32_t LMX2492Trace::Timestamp()
+{
+	// ns, wraps after 4.29 s
+	return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t LMX2492Trace::TicksPerSecond()
+{
+	return 1000000000UL;
+}
+
+#elif defined(DWT_CTRL_CYCCNTENA_Msk)
+
+void LMX2492Trace::Start()
+{
+	// Enable the DWT cycle counter
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t LMX2492Trace::Timestamp()
+{
+	return DWT->CYCCNT;
+}
+
+uint32_t LMX2492Trace::TicksPerSecond()
+{
+	return SystemCoreClock;
+}
+
+#else
+
+void LMX2492Trace::Start() { }
+
+uint32_t LMX2492Trace::Timestamp()
+{
+	// No cycle counter (Cortex-M0): HAL tick and SysTick down counter,
+	// not exact across a tick increment in between the two reads
+	uint32_t load = SysTick->LOAD + 1;
+
+	return HAL_GetTick() * load + (load - 1 - SysTick->VAL);
+}
+
+uint32_t LMX2492Trace::TicksPerSecond()
+{
+	return SystemCoreClock;
+}
+
+#endif
+
+} /* namespace bsp */
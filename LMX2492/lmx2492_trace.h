@@ -0,0 +1,125 @@
+/*
+ * lmx2492_trace.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_TRACE_H_
+#define LMX2492_TRACE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Tracing of the driver SPI transactions is compiled in with LMX2492_TRACE defined,
+// the LMX2492_TRACE_* hooks expand to nothing otherwise.
+
+// Traced operations
+#define LMX2492_TRACE_WRITE			0	// Blocking write frame
+#define LMX2492_TRACE_READ			1	// Blocking read
+#define LMX2492_TRACE_WRITE_ASYNC	2	// DMA write frame, ends in the complete interrupt
+#define LMX2492_TRACE_REPLAY		3	// Chained DMA replay of a sequence
+#define LMX2492_TRACE_OP_COUNT		4
+
+// Latency histogram buckets, bucket i counts latencies of 2^i ... 2^(i+1) - 1 ticks
+#define LMX2492_TRACE_BUCKETS		32
+
+namespace bsp
+{
+
+	// Traced SPI transaction, timestamps in ticks (see LMX2492Trace::TicksPerSecond)
+	typedef struct {
+		uint32_t start;			// Transaction requested
+		uint32_t configured;	// Bus acquired and peripheral configured (HAL_SPI_Init if changed)
+		uint32_t selected;		// CS asserted
+		uint32_t end;			// CS released after the last byte
+		uint16_t address;		// First register
+		uint16_t size;			// Bytes on the bus including the header
+		uint8_t op;				// LMX2492_TRACE_*
+		uint8_t result;			// 1 success, 0 failure
+	} LMX2492_Trace_Record_TypeDef;
+
+	// Per operation statistics
+	typedef struct {
+		uint32_t count;
+		uint32_t failures;
+		uint64_t bytes;
+		uint64_t ticks;			// Sum of the latencies
+		uint32_t ticks_max;
+		uint32_t histogram[LMX2492_TRACE_BUCKETS];
+	} LMX2492_Trace_Stats_TypeDef;
+
+	// Transaction trace of one driver: lock-free single producer / single consumer ring
+	// of records and latency statistics. The producer is the driver including its SPI
+	// interrupt, records are dropped while the ring is full.
+	class LMX2492Trace
+	{
+	public:
+		// Ring stored in a user provided array, capacity must be a power of two
+		LMX2492Trace(LMX2492_Trace_Record_TypeDef* buffer, size_t capacity);
+
+		// Log a finished transaction (producer)
+		void Log(const LMX2492_Trace_Record_TypeDef* record);
+
+		// Take the oldest record, returns false if the ring is empty (consumer)
+		bool Read(LMX2492_Trace_Record_TypeDef* record);
+
+		// Statistics of an operation, may be torn while the producer is active
+		const LMX2492_Trace_Stats_TypeDef* Stats(uint8_t op) const;
+
+		// Records dropped because the ring was full
+		uint32_t Dropped() const;
+
+		// Clear records and statistics, the producer must be idle
+		void Clear();
+
+		// Write the statistics as CSV (op, count, failures, bytes, ticks, ticks_max,
+		// histogram buckets) to buffer, returns the length of the text
+		size_t Dump(char* buffer, size_t size) const;
+
+		// Enable the timestamp counter (DWT cycle counter on Cortex-M3 and above)
+		static void Start();
+
+		// Current timestamp: DWT cycles, SysTick based cycles on Cortex-M0 or steady_clock ns on a host
+		static uint32_t Timestamp();
+
+		// Timestamp frequency in Hz
+		static uint32_t TicksPerSecond();
+
+	private:
+		LMX2492_Trace_Record_TypeDef* buffer_;
+		size_t mask_;
+		std::atomic<uint32_t> head_;
+		std::atomic<uint32_t> tail_;
+		uint32_t dropped_;
+
+		LMX2492_Trace_Stats_TypeDef stats_[LMX2492_TRACE_OP_COUNT];
+	};
+
+}; /* namespace bsp */
+
+#ifdef LMX2492_TRACE
+
+// Start a traced transaction in a driver method, trace_ is the driver's LMX2492Trace
+#define LMX2492_TRACE_BEGIN(rec, op_, address_, size_) \
+	bsp::LMX2492_Trace_Record_TypeDef rec = { 0, 0, 0, 0, 0, 0, 0, 0 }; \
+	if (trace_ != NULL) { rec.start = bsp::LMX2492Trace::Timestamp(); rec.op = (op_); rec.address = (uint16_t)(address_); rec.size = (uint16_t)(size_); }
+
+// Timestamp a phase of the transaction
+#define LMX2492_TRACE_MARK(rec, field) \
+	if (trace_ != NULL) { rec.field = bsp::LMX2492Trace::Timestamp(); }
+
+// Finish the transaction, evaluates to result
+#define LMX2492_TRACE_END(rec, result_) \
+	(((trace_ != NULL) ? (rec.end = bsp::LMX2492Trace::Timestamp(), rec.result = (result_) ? 1 : 0, trace_->Log(&rec), 0) : 0), (result_))
+
+#else
+
+#define LMX2492_TRACE_BEGIN(rec, op_, address_, size_)
+#define LMX2492_TRACE_MARK(rec, field)
+#define LMX2492_TRACE_END(rec, result_)		(result_)
+
+#endif
+
+#endif /* LMX2492_TRACE_H_ */
@@ -8,11 +8,14 @@
 #ifndef LMX2492_RICHARDS_FRACTION_H_
 #define LMX2492_RICHARDS_FRACTION_H_
 
+#include <stdint.h>
+
 #define RICHARDS_MAX_ITER	100
 #define RICHARDS_ACCURACY	1e-7
 
 // Richards fraction algorithm for fractions 0 <= x <= 1
-uint32_t richards_fraction(float x, uint32_t& num, uint32_t& den, float epsilon = RICHARDS_ACCURACY)
+// Superseded by best_rational() (best_rational.h), kept for comparison in the benchmarks
+inline uint32_t richards_fraction(float x, uint32_t& num, uint32_t& den, float epsilon = RICHARDS_ACCURACY)
 {
 	// min and max value within accuracy range
 	float min = x - epsilon;
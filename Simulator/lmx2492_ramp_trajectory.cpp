@@ -0,0 +1,322 @@
+/*
+ * lmx2492_ramp_trajectory.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_ramp_trajectory.h>
+#include <lmx2492_fields.h>
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+namespace bsp {
+
+// Sign extend a n bit two's complement value
+static inline int64_t sign_extend(uint64_t value, uint8_t bits)
+{
+	uint64_t sign = 1ULL << (bits - 1);
+
+	value &= (sign << 1) - 1;
+
+	return (int64_t)(value ^ sign) - (int64_t)sign;
+}
+
+LMX2492RampTrajectory::LMX2492RampTrajectory(const LMX2492_Ramp_Config_TypeDef *ramp_config, const LMX2492_Ramp_TypeDef ramps[8], double fPFD, double fmod)
+{
+	assert(ramp_config != NULL);
+	assert(ramps != NULL);
+	assert(fPFD > 0);
+
+	memcpy(&ramp_config_, ramp_config, sizeof(ramp_config_));
+	memcpy(ramps_, ramps, sizeof(ramps_));
+
+	fPFD_ = fPFD;
+	fmod_ = fmod;
+}
+
+void LMX2492RampTrajectory::SetTrigger(uint8_t trigger, const double *times, size_t count)
+{
+	assert((trigger >= LMX2492_RAMPx_NEXT_TRIG_TRIG_A) && (trigger <= LMX2492_RAMPx_NEXT_TRIG_TRIG_C));
+
+	std::vector<double>& events = triggers_[trigger - LMX2492_RAMPx_NEXT_TRIG_TRIG_A];
+
+	events.assign(times, times + count);
+	std::sort(events.begin(), events.end());
+}
+
+void LMX2492RampTrajectory::Append(double start, double duration, double period, double f_start, double f_step, uint8_t ramp_idx)
+{
+	if(duration <= 0)
+		return;
+
+	LMX2492_Ramp_Segment_TypeDef segment = { start, duration, period, f_start, f_step, ramp_idx };
+	segments_.push_back(segment);
+}
+
+size_t LMX2492RampTrajectory::Build(double t_end, size_t max_segments)
+{
+	segments_.clear();
+
+	const uint8_t *rc = (const uint8_t*)&ramp_config_;
+
+	if(!LMX2492FieldGet<LMX2492_FIELD_RAMP_EN>(rc, LMX2492_RAMP_CONFIG_ADDRESS))
+	{
+		Append(0, t_end, t_end, 0, 0, 0);
+		return segments_.size();
+	}
+
+	// Ramp clock and frequency of one accumulator LSB (fixed 2^24 denominator)
+	double fclk = (LMX2492FieldGet<LMX2492_FIELD_RAMP_CLK>(rc, LMX2492_RAMP_CONFIG_ADDRESS) == LMX2492_RAMP_CLK_MOD) ? fmod_ : fPFD_;
+	double res = fPFD_ / 16777216.0;
+
+	assert(fclk > 0);
+
+	// 33 bit two's complement limits
+	int64_t high = sign_extend(LMX2492FieldGet<LMX2492_FIELD_RAMP_LIMIT_HIGH>(rc, LMX2492_RAMP_CONFIG_ADDRESS), 33);
+	int64_t low = sign_extend(LMX2492FieldGet<LMX2492_FIELD_RAMP_LIMIT_LOW>(rc, LMX2492_RAMP_CONFIG_ADDRESS), 33);
+
+	size_t trigger_pos[3] = { 0, 0, 0 };
+	double t = 0;
+	int64_t acc = 0;
+	uint8_t slot = 0;
+
+	// Bound the walk, slots with zero length and no trigger do not advance the time
+	for(size_t iter = 0; (t < t_end) && (segments_.size() < max_segments) && (iter < 2 * max_segments); ++iter)
+	{
+		const LMX2492_Ramp_TypeDef *r = &ramps_[slot];
+
+		if(LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_RST>(r))
+			acc = 0;
+
+		double period = (LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_DLY>(r) + 1) / fclk;
+		int64_t len = (int64_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_LEN>(r);
+		int64_t inc = sign_extend(LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_INC>(r), 30);
+
+		// Increments until a limit is reached
+		int64_t steps = len;
+
+		if((inc > 0) && (acc + inc * len > high))
+			steps = (acc >= high) ? 0 : (high - acc) / inc;
+		else if((inc < 0) && (acc + inc * len < low))
+			steps = (acc <= low) ? 0 : (acc - low) / -inc;
+
+		Append(t, steps * period, period, acc * res, inc * res, slot);
+		acc += inc * steps;
+
+		// Hold at the limit for the rest of the ramp
+		if(steps < len)
+		{
+			acc = (inc > 0) ? high : low;
+			Append(t + steps * period, (len - steps) * period, (len - steps) * period, acc * res, 0, slot);
+		}
+
+		t += len * period;
+
+		// Wait for the trigger
+		uint8_t trig = (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(r);
+
+		if((trig >= LMX2492_RAMPx_NEXT_TRIG_TRIG_A) && (trig <= LMX2492_RAMPx_NEXT_TRIG_TRIG_C))
+		{
+			const std::vector<double>& events = triggers_[trig - LMX2492_RAMPx_NEXT_TRIG_TRIG_A];
+			size_t& pos = trigger_pos[trig - LMX2492_RAMPx_NEXT_TRIG_TRIG_A];
+
+			while((pos < events.size()) && (events[pos] < t))
+				++pos;
+
+			// No further trigger, hold forever
+			if(pos >= events.size())
+			{
+				Append(t, t_end - t, t_end - t, acc * res, 0, slot);
+				break;
+			}
+
+			Append(t, events[pos] - t, events[pos] - t, acc * res, 0, slot);
+			t = events[pos++];
+		}
+
+		slot = (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT>(r);
+	}
+
+	return segments_.size();
+}
+
+const std::vector<LMX2492_Ramp_Segment_TypeDef>& LMX2492RampTrajectory::Segments() const
+{
+	return segments_;
+}
+
+double LMX2492RampTrajectory::FrequencyAt(double t) const
+{
+	if(segments_.empty())
+		return 0;
+
+	// Last segment starting at or before t
+	size_t lo = 0, hi = segments_.size();
+
+	while(hi - lo > 1)
+	{
+		size_t mid = (lo + hi) / 2;
+
+		if(segments_[mid].start <= t)
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	const LMX2492_Ramp_Segment_TypeDef& s = segments_[lo];
+	double k = floor((std::min(std::max(t, s.start), s.start + s.duration) - s.start) / s.period);
+
+	return s.f_start + s.f_step * k;
+}
+
+void LMX2492RampTrajectory::Sample(double t0, double fs, double *out, size_t count) const
+{
+	assert(fs > 0);
+
+	if(segments_.empty())
+	{
+		std::fill(out, out + count, 0.0);
+		return;
+	}
+
+	size_t filled = 0;
+
+	for(size_t n = 0; (n < segments_.size()) && (filled < count); ++n)
+	{
+		const LMX2492_Ramp_Segment_TypeDef& s = segments_[n];
+
+		// Sample index range covered by the segment
+		double end = (s.start + s.duration - t0) * fs;
+
+		if(end <= 0)
+			continue;
+
+		size_t i1 = (end >= (double)count) ? count : (size_t)ceil(end);
+
+		if(i1 <= filled)
+			continue;
+
+		// Branch free per sample: f = f_start + f_step * k with k = trunc(a + j * b).
+		// The int32 lane counter and truncation keep the loop vectorizable without SSE4.1 floor,
+		// k >= 0 within the segment and a rounding error slightly below zero truncates to 0.
+		assert(i1 - filled <= 0x7FFFFFFF);
+
+		const int32_t m = (int32_t)(i1 - filled);
+		const double b = 1.0 / (fs * s.period);
+		const double a = (t0 - s.start) / s.period + (double)filled * b;
+		const double f_start = s.f_start;
+		const double f_step = s.f_step;
+		double * __restrict__ dst = out + filled;
+
+		for(int32_t j = 0; j < m; ++j)
+			dst[j] = f_start + f_step * (double)(int32_t)(a + (double)j * b);
+
+		filled = i1;
+	}
+
+	// Hold the final value after the last segment
+	const LMX2492_Ramp_Segment_TypeDef& last = segments_.back();
+	double f_end = last.f_start + last.f_step * floor(last.duration / last.period);
+
+	std::fill(out + filled, out + count, f_end);
+}
+
+LMX2492_Chirp_Report_TypeDef LMX2492RampTrajectory::AnalyzeSamples(const double *f, size_t count, double fs, const LMX2492_Chirp_TypeDef *chirp)
+{
+	LMX2492_Chirp_Report_TypeDef report;
+	memset(&report, 0, sizeof(report));
+
+	if(count < 2)
+		return report;
+
+	// Least squares line on centered time, t_i = i / fs
+	double n = (double)count;
+	double t_mean = (n - 1) / (2 * fs);
+	double f_mean = 0;
+
+	for(size_t i = 0; i < count; ++i)
+		f_mean += f[i];
+
+	f_mean /= n;
+
+	double stf = 0, stt = 0;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		double dt = i / fs - t_mean;
+		stf += dt * (f[i] - f_mean);
+		stt += dt * dt;
+	}
+
+	report.slope = stf / stt;
+
+	double slope = chirp->df / chirp->duration;
+	report.slope_error = (slope != 0) ? (report.slope - slope) / slope : 0;
+
+	// Residuals to the fitted and to the intended line
+	double sq = 0;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		double t = i / fs;
+		double fit = f_mean + report.slope * (t - t_mean);
+		double res = fabs(f[i] - fit);
+		double dev = fabs(f[i] - (chirp->f_start + slope * t));
+
+		report.linearity_max = std::max(report.linearity_max, res);
+		report.deviation_max = std::max(report.deviation_max, dev);
+		sq += res * res;
+	}
+
+	report.linearity_rms = sqrt(sq / n);
+
+	return report;
+}
+
+LMX2492_Chirp_Report_TypeDef LMX2492RampTrajectory::Analyze(const LMX2492_Chirp_TypeDef *chirp, double fs) const
+{
+	assert(chirp != NULL);
+	assert(chirp->duration > 0);
+
+	std::vector<double> f((size_t)ceil(chirp->duration * fs));
+	Sample(chirp->start, fs, f.data(), f.size());
+
+	LMX2492_Chirp_Report_TypeDef report = AnalyzeSamples(f.data(), f.size(), fs, chirp);
+
+	// Contiguous ramping segments overlapping the chirp
+	double end = chirp->start + chirp->duration;
+	bool found = false;
+
+	for(size_t n = 0; n < segments_.size(); ++n)
+	{
+		const LMX2492_Ramp_Segment_TypeDef& s = segments_[n];
+
+		if(s.f_step == 0)
+		{
+			if(found) break;
+			continue;
+		}
+
+		if(!found)
+		{
+			if(s.start + s.duration <= chirp->start)
+				continue;
+			if(s.start >= end)
+				break;
+
+			report.ramp_start = s.start;
+			found = true;
+		}
+
+		report.ramp_duration = s.start + s.duration - report.ramp_start;
+		report.ramp_df += s.f_step * floor(s.duration / s.period + 0.5);
+	}
+
+	return report;
+}
+
+} /* namespace bsp */
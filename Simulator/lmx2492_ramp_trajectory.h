@@ -0,0 +1,97 @@
+/*
+ * lmx2492_ramp_trajectory.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_RAMP_TRAJECTORY_H_
+#define LMX2492_RAMP_TRAJECTORY_H_
+
+#include <lmx2492_regdef.h>
+
+#include <stddef.h>
+#include <vector>
+
+namespace bsp
+{
+
+	// Piece of the trajectory with a constant increment.
+	// f(t) = f_start + f_step * floor((t - start) / period) for start <= t < start + duration
+	typedef struct {
+		double start;		// Start time in s
+		double duration;	// Duration in s
+		double period;		// Time between increments in s
+		double f_start;		// Frequency offset at start in Hz
+		double f_step;		// Frequency increment in Hz, 0 while holding
+		uint8_t ramp_idx;	// Ramp slot
+	} LMX2492_Ramp_Segment_TypeDef;
+
+	// Intended linear chirp
+	typedef struct {
+		double start;		// Start time in s
+		double duration;	// Duration in s
+		double f_start;		// Frequency offset at start in Hz
+		double df;			// Frequency delta in Hz
+	} LMX2492_Chirp_TypeDef;
+
+	// Result of a chirp analysis
+	typedef struct {
+		double slope;				// Least squares slope in Hz/s
+		double slope_error;			// Relative slope error
+		double linearity_max;		// Max. deviation from the least squares line in Hz
+		double linearity_rms;		// RMS deviation from the least squares line in Hz
+		double deviation_max;		// Max. deviation from the intended chirp in Hz
+		double ramp_start;			// Start of the ramping segments covering the chirp in s
+		double ramp_duration;		// Duration of the ramping segments covering the chirp in s
+		double ramp_df;				// Frequency delta of the ramping segments in Hz
+	} LMX2492_Chirp_Report_TypeDef;
+
+	// Model of the LMX2492 ramp engine: programmed frequency offset over time
+	// from the ramp configuration and the eight ramp slots.
+	// Honors INC accumulation, LEN, NEXT, RST, DLY, NEXT_TRIG waits and the ramp limits.
+	class LMX2492RampTrajectory
+	{
+	public:
+		// fPFD .. phase detector frequency in Hz
+		// fmod .. ramp clock on the MOD pin in Hz, used with RAMP_CLK = LMX2492_RAMP_CLK_MOD
+		LMX2492RampTrajectory(const LMX2492_Ramp_Config_TypeDef* ramp_config, const LMX2492_Ramp_TypeDef ramps[8], double fPFD, double fmod = 0);
+
+		// Trigger event times in s of trigger A, B or C (LMX2492_RAMPx_NEXT_TRIG_TRIG_x).
+		// Without events a ramp waiting for the trigger holds forever.
+		void SetTrigger(uint8_t trigger, const double* times, size_t count);
+
+		// Walk the ramp engine until t_end or max_segments, returns the number of segments
+		size_t Build(double t_end, size_t max_segments = 100000);
+
+		// Segments of the last Build()
+		const std::vector<LMX2492_Ramp_Segment_TypeDef>& Segments() const;
+
+		// Frequency offset in Hz at time t
+		double FrequencyAt(double t) const;
+
+		// Sample the frequency offset at rate fs starting at t0.
+		// The inner loop has no branches per sample, GCC -O3 vectorizes it (see -fopt-info-vec).
+		void Sample(double t0, double fs, double* out, size_t count) const;
+
+		// Compare the trajectory with an intended chirp, sampled at rate fs
+		LMX2492_Chirp_Report_TypeDef Analyze(const LMX2492_Chirp_TypeDef* chirp, double fs) const;
+
+		// Compare sampled frequencies (time of out[0] = chirp->start) with an intended chirp
+		static LMX2492_Chirp_Report_TypeDef AnalyzeSamples(const double* f, size_t count, double fs, const LMX2492_Chirp_TypeDef* chirp);
+
+	private:
+		LMX2492_Ramp_Config_TypeDef ramp_config_;
+		LMX2492_Ramp_TypeDef ramps_[8];
+		double fPFD_;
+		double fmod_;
+		std::vector<double> triggers_[3];
+		std::vector<LMX2492_Ramp_Segment_TypeDef> segments_;
+
+		// Append a segment, skips empty ones
+		void Append(double start, double duration, double period, double f_start, double f_step, uint8_t ramp_idx);
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_RAMP_TRAJECTORY_H_ */
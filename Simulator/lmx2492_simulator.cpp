@@ -0,0 +1,303 @@
+/*
+ * lmx2492_simulator.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <lmx2492_simulator.h>
+#include <lmx2492_fields.h>
+
+#include <string.h>
+
+namespace bsp {
+
+LMX2492Simulator::LMX2492Simulator()
+{
+	selected_ = false;
+	frame_pos_ = 0;
+	header_ = 0;
+	read_ = false;
+	address_ = 0;
+
+	PowerOnReset();
+	ResetCounters();
+}
+
+bool LMX2492Simulator::Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz)
+{
+	(void)speed_hz;
+
+	// SPI mode 0, 8 bit words only
+	return (mode == 0) && (bits_per_word == 8);
+}
+
+bool LMX2492Simulator::Transfer(const struct spi_ioc_transfer *segments, size_t count)
+{
+	++messages_;
+
+	for(size_t i = 0; i < count; ++i)
+	{
+		const struct spi_ioc_transfer *seg = &segments[i];
+		const uint8_t *tx = (const uint8_t*)(uintptr_t)seg->tx_buf;
+		uint8_t *rx = (uint8_t*)(uintptr_t)seg->rx_buf;
+
+		if(!selected_ && (seg->len > 0))
+			Select();
+
+		for(uint32_t j = 0; j < seg->len; ++j)
+		{
+			uint8_t miso = Clock((tx != NULL) ? tx[j] : 0);
+
+			if(rx != NULL)
+				rx[j] = miso;
+		}
+
+		// cs_change releases CS between segments, but keeps it asserted after the last one
+		if(selected_ && (seg->cs_change != (i + 1 == count)))
+			Deselect();
+	}
+
+	return true;
+}
+
+void LMX2492Simulator::PowerOnReset()
+{
+	// POR values of all fields
+	memcpy(registers_, LMX2492_RESET_IMAGE.data, sizeof(registers_));
+
+	memcpy(buffered_, registers_, sizeof(buffered_));
+}
+
+uint8_t LMX2492Simulator::Register(uint16_t address) const
+{
+	if(address >= LMX2492_REGISTER_COUNT)
+		return 0;
+
+	return registers_[address];
+}
+
+void LMX2492Simulator::Config(LMX2492_Config_TypeDef *config) const
+{
+	memcpy(config, &registers_[LMX2492_CONFIG_ADDRESS], sizeof(LMX2492_Config_TypeDef));
+}
+
+void LMX2492Simulator::GPIOConfig(LMX2492_GPIO_Config_TypeDef *gpio_config) const
+{
+	memcpy(gpio_config, &registers_[LMX2492_GPIO_CONFIG_ADDRESS], sizeof(LMX2492_GPIO_Config_TypeDef));
+}
+
+void LMX2492Simulator::RampConfig(LMX2492_Ramp_Config_TypeDef *ramp_config) const
+{
+	memcpy(ramp_config, &registers_[LMX2492_RAMP_CONFIG_ADDRESS], sizeof(LMX2492_Ramp_Config_TypeDef));
+}
+
+void LMX2492Simulator::Ramp(LMX2492_Ramp_TypeDef *ramp, uint8_t ramp_idx) const
+{
+	memcpy(ramp, &registers_[LMX2492_RAMP_ADDRESS(ramp_idx & 0x07)], sizeof(LMX2492_Ramp_TypeDef));
+}
+
+uint32_t LMX2492Simulator::PLL_N() const
+{
+	return (uint32_t)LMX2492FieldGet<LMX2492_FIELD_PLL_N>(registers_, 0);
+}
+
+uint32_t LMX2492Simulator::FracNum() const
+{
+	return (uint32_t)LMX2492FieldGet<LMX2492_FIELD_FRAC_NUM>(registers_, 0);
+}
+
+uint32_t LMX2492Simulator::FracDen() const
+{
+	return (uint32_t)LMX2492FieldGet<LMX2492_FIELD_FRAC_DEN>(registers_, 0);
+}
+
+uint16_t LMX2492Simulator::PLL_R() const
+{
+	return (uint16_t)LMX2492FieldGet<LMX2492_FIELD_PLL_R>(registers_, 0);
+}
+
+double LMX2492Simulator::Frequency(double fref) const
+{
+	uint16_t R = PLL_R();
+	uint32_t den = FracDen();
+
+	if((R == 0) || (den == 0))
+		return 0;
+
+	double fPFD = fref * (LMX2492FieldGet<LMX2492_FIELD_OSC_2X>(registers_, 0) + 1) / R;
+
+	return fPFD * (PLL_N() + (double)FracNum() / den);
+}
+
+int32_t LMX2492Simulator::RampIncrement(uint8_t ramp_idx) const
+{
+	uint32_t inc = (uint32_t)LMX2492FieldGet<LMX2492_FIELD_RAMP0_INC>(&registers_[LMX2492_RAMP_ADDRESS(ramp_idx & 0x07)], LMX2492_RAMP_ADDRESS(0));
+
+	// Sign extend 30 bit two's complement
+	if(inc & (1UL << 29))
+		inc |= 0xC0000000UL;
+
+	return (int32_t)inc;
+}
+
+uint16_t LMX2492Simulator::RampLength(uint8_t ramp_idx) const
+{
+	return (uint16_t)LMX2492FieldGet<LMX2492_FIELD_RAMP0_LEN>(&registers_[LMX2492_RAMP_ADDRESS(ramp_idx & 0x07)], LMX2492_RAMP_ADDRESS(0));
+}
+
+bool LMX2492Simulator::LatchPending() const
+{
+	return memcmp(&buffered_[LMX2492_PLL_BUFFERED_ADDRESS], &registers_[LMX2492_PLL_BUFFERED_ADDRESS],
+			LMX2492_PLL_BUFFERED_LAST_ADDRESS - LMX2492_PLL_BUFFERED_ADDRESS + 1) != 0;
+}
+
+void LMX2492Simulator::ResetCounters()
+{
+	messages_ = 0;
+	frames_ = 0;
+	bytes_ = 0;
+	written_ = 0;
+	read_bytes_ = 0;
+	resets_ = 0;
+	order_violations_ = 0;
+
+	ResetOrder();
+}
+
+void LMX2492Simulator::ResetOrder()
+{
+	frame_low_ = -1;
+	last_frame_low_ = -1;
+}
+
+uint32_t LMX2492Simulator::Messages() const
+{
+	return messages_;
+}
+
+uint32_t LMX2492Simulator::Frames() const
+{
+	return frames_;
+}
+
+uint32_t LMX2492Simulator::Bytes() const
+{
+	return bytes_;
+}
+
+uint32_t LMX2492Simulator::WrittenBytes() const
+{
+	return written_;
+}
+
+uint32_t LMX2492Simulator::ReadBytes() const
+{
+	return read_bytes_;
+}
+
+uint32_t LMX2492Simulator::Resets() const
+{
+	return resets_;
+}
+
+uint32_t LMX2492Simulator::OrderViolations() const
+{
+	return order_violations_;
+}
+
+void LMX2492Simulator::Select()
+{
+	selected_ = true;
+	frame_pos_ = 0;
+	frame_low_ = -1;
+
+	++frames_;
+}
+
+void LMX2492Simulator::Deselect()
+{
+	selected_ = false;
+
+	// Write frame completed
+	if(frame_low_ >= 0)
+		last_frame_low_ = frame_low_;
+}
+
+uint8_t LMX2492Simulator::Clock(uint8_t mosi)
+{
+	uint8_t miso = 0;
+
+	++bytes_;
+
+	if(frame_pos_ == 0)
+	{
+		// 1 bit R/~W, address bits 14:8
+		header_ = mosi;
+	}
+	else if(frame_pos_ == 1)
+	{
+		read_ = (header_ & 0x80) != 0;
+		address_ = ((header_ & 0x7F) << 8) | mosi;
+
+		// Frames have to start below the previous write frame
+		if(!read_ && (last_frame_low_ >= 0) && (address_ > last_frame_low_))
+			++order_violations_;
+	}
+	else if((address_ >= 0) && (address_ < LMX2492_REGISTER_COUNT))
+	{
+		if(read_)
+		{
+			miso = registers_[address_];
+			++read_bytes_;
+		}
+		else
+		{
+			// A soft reset clears the frame order tracking again
+			frame_low_ = address_;
+			Write((uint16_t)address_, mosi);
+			++written_;
+		}
+
+		// Address auto decrement
+		--address_;
+	}
+
+	++frame_pos_;
+
+	return miso;
+}
+
+void LMX2492Simulator::Write(uint16_t address, uint8_t value)
+{
+	// Soft reset, all registers back at POR values
+	if((address == LMX2492_SWRST_ADDR) && (value & LMX2492_SWRST_RESET))
+	{
+		PowerOnReset();
+		++resets_;
+
+		// Programming starts over
+		frame_low_ = -1;
+		last_frame_low_ = -1;
+		return;
+	}
+
+	if((address >= LMX2492_PLL_BUFFERED_ADDRESS) && (address <= LMX2492_PLL_BUFFERED_LAST_ADDRESS))
+	{
+		// Effective with the next write of PLL_N[7:0]
+		buffered_[address] = value;
+		return;
+	}
+
+	registers_[address] = value;
+	buffered_[address] = value;
+
+	// Latch double buffered registers
+	if(address == LMX2492_PLL_LATCH_ADDR)
+	{
+		memcpy(&registers_[LMX2492_PLL_BUFFERED_ADDRESS], &buffered_[LMX2492_PLL_BUFFERED_ADDRESS],
+				LMX2492_PLL_BUFFERED_LAST_ADDRESS - LMX2492_PLL_BUFFERED_ADDRESS + 1);
+	}
+}
+
+} /* namespace bsp */
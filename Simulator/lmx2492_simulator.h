@@ -0,0 +1,122 @@
+/*
+ * lmx2492_simulator.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef LMX2492_SIMULATOR_H_
+#define LMX2492_SIMULATOR_H_
+
+#include <lmx2492_regdef.h>
+#include <spidevice.h>
+
+namespace bsp
+{
+
+	// Register level model of the LMX2492 SPI front end.
+	// Used as SpiDevice of the Linux SpiSlave backend it decodes the byte stream
+	// of the driver (16 bit header, data in descending address order) into a
+	// register file and answers reads from it.
+	class LMX2492Simulator : public SpiDevice
+	{
+	public:
+		LMX2492Simulator();
+
+		virtual bool Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz);
+
+		virtual bool Transfer(const struct spi_ioc_transfer* segments, size_t count);
+
+		// Restore the POR register values
+		void PowerOnReset();
+
+		// Register contents as read back by the device
+		uint8_t Register(uint16_t address) const;
+
+		// Decoded registers, double buffered values as currently effective
+		void Config(LMX2492_Config_TypeDef* config) const;
+		void GPIOConfig(LMX2492_GPIO_Config_TypeDef* gpio_config) const;
+		void RampConfig(LMX2492_Ramp_Config_TypeDef* ramp_config) const;
+		void Ramp(LMX2492_Ramp_TypeDef* ramp, uint8_t ramp_idx) const;
+
+		// Decoded PLL dividers
+		uint32_t PLL_N() const;
+		uint32_t FracNum() const;
+		uint32_t FracDen() const;
+		uint16_t PLL_R() const;
+
+		// Output frequency in Hz for the given reference frequency
+		double Frequency(double fref) const;
+
+		// Decoded ramp increment (sign extended 30 bit two's complement) and length
+		int32_t RampIncrement(uint8_t ramp_idx) const;
+		uint16_t RampLength(uint8_t ramp_idx) const;
+
+		// Double buffered PLL registers written but not yet latched by PLL_N[7:0]
+		bool LatchPending() const;
+
+		// Reset all counters
+		void ResetCounters();
+
+		// Executed messages (equals syscalls on a spidev device)
+		uint32_t Messages() const;
+
+		// Frames, i.e. CS assertions
+		uint32_t Frames() const;
+
+		// Transferred bytes including headers
+		uint32_t Bytes() const;
+
+		// Data bytes written to and read from registers
+		uint32_t WrittenBytes() const;
+		uint32_t ReadBytes() const;
+
+		// Soft resets
+		uint32_t Resets() const;
+
+		// Write frames starting above the lowest address of the previous write frame.
+		// The driver programs the register map top down (see Example_STM32_HAL).
+		// The previous frame is kept across operations until ResetOrder(), ResetCounters() or a
+		// soft reset, call ResetOrder() before each Commit() or sequence that is checked.
+		uint32_t OrderViolations() const;
+
+		// Start a new group of write frames for the order check, the counters are kept
+		void ResetOrder();
+
+	private:
+		// Effective registers and write buffers of the double buffered PLL registers
+		uint8_t registers_[LMX2492_REGISTER_COUNT];
+		uint8_t buffered_[LMX2492_REGISTER_COUNT];
+
+		// Frame decoder state
+		bool selected_;
+		uint32_t frame_pos_;
+		uint8_t header_;
+		bool read_;
+		int32_t address_;
+		// Lowest address written by the current and the previous write frame
+		int32_t frame_low_;
+		int32_t last_frame_low_;
+
+		uint32_t messages_;
+		uint32_t frames_;
+		uint32_t bytes_;
+		uint32_t written_;
+		uint32_t read_bytes_;
+		uint32_t resets_;
+		uint32_t order_violations_;
+
+		// Decode one byte, returns the byte on MISO
+		uint8_t Clock(uint8_t mosi);
+
+		// CS edges
+		void Select();
+		void Deselect();
+
+		// Register write with double buffering and soft reset
+		void Write(uint16_t address, uint8_t value);
+	};
+
+}; /* namespace bsp */
+
+#endif /* LMX2492_SIMULATOR_H_ */
@@ -0,0 +1,204 @@
+/*
+ * spidevice.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <spidevice.h>
+
+#include <assert.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+bsp::SpiDevice::SpiDevice()
+ : owner_(NULL), reserved_(NULL)
+{ }
+
+bsp::SpiDevice::~SpiDevice() { }
+
+bsp::SpidevDevice::SpidevDevice(const char *path)
+{
+	fd_ = open(path, O_RDWR);
+
+	configured_ = false;
+	mode_ = 0;
+	bits_per_word_ = 0;
+	speed_hz_ = 0;
+}
+
+bsp::SpidevDevice::~SpidevDevice()
+{
+	if (fd_ >= 0)
+		close(fd_);
+}
+
+bool bsp::SpidevDevice::IsOpen() const
+{
+	return fd_ >= 0;
+}
+
+bool bsp::SpidevDevice::Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz)
+{
+	if (fd_ < 0)
+		return false;
+
+	// Skip if already applied
+	if (configured_ && (mode_ == mode) && (bits_per_word_ == bits_per_word) && (speed_hz_ == speed_hz))
+		return true;
+
+	configured_ = false;
+
+	if (ioctl(fd_, SPI_IOC_WR_MODE, &mode) < 0)
+		return false;
+
+	if (ioctl(fd_, SPI_IOC_WR_BITS_PER_WORD, &bits_per_word) < 0)
+		return false;
+
+	if ((speed_hz != 0) && (ioctl(fd_, SPI_IOC_WR_MAX_SPEED_HZ, &speed_hz) < 0))
+		return false;
+
+	mode_ = mode;
+	bits_per_word_ = bits_per_word;
+	speed_hz_ = speed_hz;
+	configured_ = true;
+
+	return true;
+}
+
+bool bsp::SpidevDevice::Transfer(const struct spi_ioc_transfer *segments, size_t count)
+{
+	if ((fd_ < 0) || (count == 0) || (count > 255))
+		return false;
+
+	// All segments in a single syscall
+	return ioctl(fd_, SPI_IOC_MESSAGE(count), segments) >= 0;
+}
+
+bsp::SpiLoopbackDevice::SpiLoopbackDevice()
+{
+	selected_ = false;
+	ResetCounters();
+}
+
+bool bsp::SpiLoopbackDevice::Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz)
+{
+	(void)mode;
+	(void)bits_per_word;
+	(void)speed_hz;
+
+	++configurations_;
+
+	return true;
+}
+
+bool bsp::SpiLoopbackDevice::Transfer(const struct spi_ioc_transfer *segments, size_t count)
+{
+	++messages_;
+
+	for (size_t i = 0; i < count; ++i) {
+		const struct spi_ioc_transfer *seg = &segments[i];
+
+		if (!selected_ && (seg->len > 0)) {
+			++selects_;
+			selected_ = true;
+		}
+
+		// MOSI to MISO
+		if (seg->rx_buf != 0) {
+			if (seg->tx_buf != 0)
+				memmove((void *)(uintptr_t)seg->rx_buf, (const void *)(uintptr_t)seg->tx_buf, seg->len);
+			else
+				memset((void *)(uintptr_t)seg->rx_buf, 0, seg->len);
+		}
+
+		++segments_;
+		bytes_ += seg->len;
+
+		// cs_change releases CS between segments, but keeps it asserted after the last one
+		if (seg->cs_change != (i + 1 == count))
+			selected_ = false;
+	}
+
+	return true;
+}
+
+void bsp::SpiLoopbackDevice::ResetCounters()
+{
+	messages_ = 0;
+	segments_ = 0;
+	selects_ = 0;
+	bytes_ = 0;
+	configurations_ = 0;
+}
+
+uint32_t bsp::SpiLoopbackDevice::Messages() const
+{
+	return messages_;
+}
+
+uint32_t bsp::SpiLoopbackDevice::Segments() const
+{
+	return segments_;
+}
+
+uint32_t bsp::SpiLoopbackDevice::Selects() const
+{
+	return selects_;
+}
+
+uint32_t bsp::SpiLoopbackDevice::Bytes() const
+{
+	return bytes_;
+}
+
+uint32_t bsp::SpiLoopbackDevice::Configurations() const
+{
+	return configurations_;
+}
+
+bsp::SpiBroadcastDevice::SpiBroadcastDevice(SpiDevice * const *devices, size_t count)
+ : devices_(devices), count_(count)
+{
+	assert(devices != NULL);
+}
+
+bool bsp::SpiBroadcastDevice::Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz)
+{
+	bool success = true;
+
+	for (size_t i = 0; i < count_; ++i)
+		success &= devices_[i]->Configure(mode, bits_per_word, speed_hz);
+
+	return success;
+}
+
+bool bsp::SpiBroadcastDevice::Transfer(const struct spi_ioc_transfer *segments, size_t count)
+{
+	// Claim all devices for the slave owning the broadcast device, so that no other
+	// slave transfers to a device between the copies of the message
+	SpiSlave *owner = owner_.load();
+	size_t claimed = 0;
+
+	assert(owner != NULL);
+
+	for (; claimed < count_; ++claimed) {
+		SpiSlave *expected = NULL;
+
+		if (!devices_[claimed]->owner_.compare_exchange_strong(expected, owner))
+			break;
+	}
+
+	bool success = (claimed == count_);
+
+	for (size_t i = 0; success && (i < count_); ++i)
+		success &= devices_[i]->Transfer(segments, count);
+
+	// Same as SpiSlave::SpiRelease(), hand over to the reserving slave if any
+	for (size_t i = 0; i < claimed; ++i)
+		devices_[i]->owner_.store(devices_[i]->reserved_.exchange(NULL));
+
+	return success;
+}
@@ -0,0 +1,139 @@
+/*
+ * spidevice.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef SPIDEVICE_H_
+#define SPIDEVICE_H_
+
+// GCC integer types
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+#include <linux/spi/spidev.h>
+
+// Board support package namespace
+namespace bsp
+{
+	class SpiSlave;
+
+	// SPI device a SpiSlave transfers its messages to.
+	// A message is a list of transfer segments sent within one CS assertion,
+	// a segment with cs_change set releases CS before the next segment.
+	class SpiDevice
+	{
+	public:
+		SpiDevice();
+
+		virtual ~SpiDevice();
+
+		// Set SPI mode (SPI_CPOL | SPI_CPHA), word size and clock, 0 keeps the device default.
+		virtual bool Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz) = 0;
+
+		// Execute one message of transfer segments
+		virtual bool Transfer(const struct spi_ioc_transfer* segments, size_t count) = 0;
+
+	private:
+		friend class SpiSlave;
+		friend class SpiBroadcastDevice;
+
+		// Slave currently owning the device and slave it is handed over to on release
+		std::atomic<SpiSlave*> owner_;
+		std::atomic<SpiSlave*> reserved_;
+	};
+
+	// Linux spidev character device, e.g. /dev/spidev0.0.
+	// A message is executed with a single SPI_IOC_MESSAGE ioctl.
+	class SpidevDevice : public SpiDevice
+	{
+	public:
+		explicit SpidevDevice(const char* path);
+
+		virtual ~SpidevDevice();
+
+		// Returns true if the device was opened
+		bool IsOpen() const;
+
+		virtual bool Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz);
+
+		virtual bool Transfer(const struct spi_ioc_transfer* segments, size_t count);
+
+	private:
+		int fd_;
+		// Applied settings, ioctls are skipped if unchanged
+		bool configured_;
+		uint8_t mode_;
+		uint8_t bits_per_word_;
+		uint32_t speed_hz_;
+	};
+
+	// Local loopback device for tests without hardware.
+	// Received data equals transmitted data (MOSI connected to MISO).
+	class SpiLoopbackDevice : public SpiDevice
+	{
+	public:
+		SpiLoopbackDevice();
+
+		virtual bool Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz);
+
+		virtual bool Transfer(const struct spi_ioc_transfer* segments, size_t count);
+
+		// Reset all counters
+		void ResetCounters();
+
+		// Executed messages (equals syscalls on a spidev device)
+		uint32_t Messages() const;
+
+		// Transfer segments
+		uint32_t Segments() const;
+
+		// CS assertions
+		uint32_t Selects() const;
+
+		// Transferred bytes
+		uint32_t Bytes() const;
+
+		// Calls of Configure()
+		uint32_t Configurations() const;
+
+	private:
+		// CS asserted
+		bool selected_;
+		uint32_t messages_;
+		uint32_t segments_;
+		uint32_t selects_;
+		uint32_t bytes_;
+		uint32_t configurations_;
+	};
+
+	// Device forwarding every message to several devices, e.g. the broadcast driver of
+	// a LMX2492Group whose devices have no common chip select. spidev can not assert
+	// several chip selects at once, the broadcast is emulated: the message is sent to each
+	// device in turn, received data is not defined. All devices are claimed for the slave
+	// owning the broadcast device during the transfer, it fails without sending anything
+	// if another slave owns one of them.
+	class SpiBroadcastDevice : public SpiDevice
+	{
+	public:
+		// Devices stored in a user provided array
+		SpiBroadcastDevice(SpiDevice* const* devices, size_t count);
+
+		virtual bool Configure(uint8_t mode, uint8_t bits_per_word, uint32_t speed_hz);
+
+		virtual bool Transfer(const struct spi_ioc_transfer* segments, size_t count);
+
+	private:
+		SpiDevice* const* devices_;
+		size_t count_;
+	};
+
+}; // namespace bsp
+
+// The SPI peripheral of a SpiSlave is a SpiDevice, CS is handled by the device
+typedef bsp::SpiDevice SPI_TypeDef;
+typedef void GPIO_TypeDef;
+
+#endif /* SPIDEVICE_H_ */
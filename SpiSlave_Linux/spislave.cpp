@@ -0,0 +1,265 @@
+/*
+ * spislave.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <spislave.h>
+
+#include <assert.h>
+#include <string.h>
+
+bsp::SpiSlave::SpiSlave(SPI_TypeDef *spi_instance, GPIO_TypeDef *cs_port,
+		uint16_t cs_pin, uint32_t max_clock)
+{
+	(void)cs_port;
+	(void)cs_pin;
+
+	assert(spi_instance != NULL);
+
+	device_ = spi_instance;
+	max_clock_ = max_clock;
+
+	mode_ = SPI_POLARITY_LOW | SPI_PHASE_1EDGE;
+	bits_per_word_ = SPI_DATASIZE_8BIT;
+	priority_ = 0;
+
+	// No transfer started
+	transfer_started_ = false;
+	cs_held_ = false;
+	segment_count_ = 0;
+}
+
+bsp::SpiSlave::~SpiSlave() { }
+
+bool bsp::SpiSlave::SpiBusy() const
+{
+	// Transfers complete before the asynchronous calls return
+	return false;
+}
+
+bool bsp::SpiSlave::SpiSameBus(const SpiSlave *other) const
+{
+	return (other != NULL) && (other->device_ == device_);
+}
+
+void bsp::SpiSlave::SetSpiPriority(uint8_t priority)
+{
+	priority_ = priority;
+}
+
+uint8_t bsp::SpiSlave::SpiPriority() const
+{
+	return priority_;
+}
+
+bool bsp::SpiSlave::SpiStart()
+{
+	return SpiAcquire() && SpiSelect();
+}
+
+bool bsp::SpiSlave::SpiAcquire()
+{
+	if (transfer_started_)
+		return false;
+
+	SpiSlave *expected = NULL;
+
+	// Claim the device unless it was handed over by SpiRelease()
+	if (device_->owner_.load() != this) {
+		if (!device_->owner_.compare_exchange_strong(expected, this)) {
+			if (priority_ > 0) {
+				// Reserve the device, keep a reservation of the same or higher priority
+				SpiSlave *current = device_->reserved_.load();
+
+				while ((current != this) && ((current == NULL) || (current->priority_ < priority_))
+						&& !device_->reserved_.compare_exchange_weak(current, this)) { }
+			}
+
+			return false;
+		}
+
+		// Acquired while idle, drop an own reservation
+		expected = this;
+		device_->reserved_.compare_exchange_strong(expected, NULL);
+	}
+
+	// Apply the configuration of this slave, skipped by the device if unchanged
+	if (!device_->Configure(mode_, bits_per_word_, max_clock_)) {
+		SpiRelease();
+		return false;
+	}
+
+	transfer_started_ = true;
+	cs_held_ = false;
+	segment_count_ = 0;
+
+	return true;
+}
+
+bool bsp::SpiSlave::SpiSelect()
+{
+	return transfer_started_;
+}
+
+bool bsp::SpiSlave::SpiEnd()
+{
+	if (!transfer_started_)
+		return true;
+
+	bool success = true;
+
+	// Send all pending segments and release CS, or release CS held by a read
+	if ((segment_count_ > 0) || cs_held_)
+		success = SpiFlush(false);
+
+	transfer_started_ = false;
+	SpiRelease();
+
+	return success;
+}
+
+void bsp::SpiSlave::SpiRelease()
+{
+	// Other slaves can not claim the device before the store
+	device_->owner_.store(device_->reserved_.exchange(NULL));
+}
+
+bool bsp::SpiSlave::SpiQueue(const uint8_t *txdata, uint8_t *rxdata, size_t size, bool cs_change)
+{
+	// Send pending segments if the message is full, CS as requested by the last one
+	if ((segment_count_ >= SPI_SLAVE_MAX_SEGMENTS) && !SpiFlush(!segments_[segment_count_ - 1].cs_change))
+		return false;
+
+	struct spi_ioc_transfer *seg = &segments_[segment_count_++];
+
+	memset(seg, 0, sizeof(*seg));
+	seg->tx_buf = (uintptr_t)txdata;
+	seg->rx_buf = (uintptr_t)rxdata;
+	seg->len = size;
+	seg->bits_per_word = bits_per_word_;
+	seg->speed_hz = max_clock_;
+	seg->cs_change = cs_change ? 1 : 0;
+
+	return true;
+}
+
+bool bsp::SpiSlave::SpiFlush(bool keep_cs)
+{
+	// Zero length segment to release a held CS
+	if (segment_count_ == 0)
+		SpiQueue(NULL, NULL, 0, false);
+
+	// cs_change on the last segment keeps CS asserted after the message
+	segments_[segment_count_ - 1].cs_change = keep_cs ? 1 : 0;
+
+	bool success = device_->Transfer(segments_, segment_count_);
+
+	segment_count_ = 0;
+	cs_held_ = keep_cs;
+
+	return success;
+}
+
+bool bsp::SpiSlave::SpiWrite(uint8_t *data, size_t size)
+{
+	if (!transfer_started_)
+		return false;
+
+	// sent with the next read or on SpiEnd()
+	return SpiQueue(data, NULL, size, false);
+}
+
+bool bsp::SpiSlave::SpiRead(uint8_t *data, size_t size)
+{
+	if (!transfer_started_)
+		return false;
+
+	// Transmit the buffer contents like the STM32 HAL does, send with pending writes
+	if (!SpiQueue(data, data, size, false))
+		return false;
+
+	return SpiFlush(true);
+}
+
+bool bsp::SpiSlave::SpiTransceive(uint8_t* txdata, uint8_t* rxdata, size_t size)
+{
+	if (!transfer_started_)
+		return false;
+
+	if (!SpiQueue(txdata, rxdata, size, false))
+		return false;
+
+	return SpiFlush(true);
+}
+
+bool bsp::SpiSlave::SpiWriteAsync(uint8_t *data, size_t size, SpiCallback callback, void *context)
+{
+	// Not started, the callback is not invoked
+	if (!SpiWrite(data, size))
+		return false;
+
+	bool success = SpiEnd();
+
+	if (callback != NULL)
+		callback(context, success);
+
+	// The result is reported to the callback only
+	return true;
+}
+
+bool bsp::SpiSlave::SpiTransceiveAsync(uint8_t *txdata, uint8_t *rxdata, size_t size, SpiCallback callback, void *context)
+{
+	if (!transfer_started_)
+		return false;
+
+	// Not started, the callback is not invoked
+	if (!SpiQueue(txdata, rxdata, size, false))
+		return false;
+
+	bool success = SpiEnd();
+
+	if (callback != NULL)
+		callback(context, success);
+
+	// The result is reported to the callback only
+	return true;
+}
+
+bool bsp::SpiSlave::SpiWriteChainAsync(const uint8_t *chain, size_t size, SpiCallback callback, void *context)
+{
+	if (!transfer_started_ || (size < 2))
+		return false;
+
+	bool success = true;
+	const uint8_t *end = chain + size;
+
+	// One segment per frame, CS released in between
+	while (success && (chain < end)) {
+		success = SpiQueue(chain + 1, NULL, chain[0], true);
+		chain += chain[0] + 1;
+	}
+
+	// Frames may have been sent already, a failure is reported like a failed DMA
+	if (success)
+		success = SpiEnd();
+	else
+		SpiEnd();
+
+	if (callback != NULL)
+		callback(context, success);
+
+	// The result is reported to the callback only
+	return true;
+}
+
+bool bsp::SpiSlave::SpiConfig(uint32_t data_size, uint32_t clk_polarity,
+		uint32_t clk_phase)
+{
+	// Applied to the device on SpiStart()
+	mode_ = (uint8_t)(clk_polarity | clk_phase);
+	bits_per_word_ = (uint8_t)data_size;
+
+	return true;
+}
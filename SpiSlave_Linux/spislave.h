@@ -0,0 +1,144 @@
+/*
+ * spislave.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef SPISLAVE_H_
+#define SPISLAVE_H_
+
+// GCC integer types
+#include <stdint.h>
+#include <stddef.h>
+
+#include <spidevice.h>
+
+// SPI configuration values of the STM32 HAL interface mapped to spidev mode bits
+#define SPI_DATASIZE_8BIT	8
+#define SPI_POLARITY_LOW	0
+#define SPI_POLARITY_HIGH	SPI_CPOL
+#define SPI_PHASE_1EDGE		0
+#define SPI_PHASE_2EDGE		SPI_CPHA
+
+// Max. number of transfer segments in one message
+#define SPI_SLAVE_MAX_SEGMENTS	32
+
+// Board support package namespace
+namespace bsp
+{
+	// Asynchronous transfer complete callback.
+	// spidev transfers are synchronous, the callback is invoked before the
+	// asynchronous call returns. Same contract as the STM32 backend: an asynchronous
+	// call that returns false did not start and never invokes the callback, the caller
+	// ends the transfer with SpiEnd(). A call that returns true reports the result
+	// to the callback only.
+	typedef void (*SpiCallback)(void* context, bool success);
+
+	// Class that gives basic SPI peripheral device data and methods.
+	// Linux spidev implementation: all writes between SpiStart() and SpiEnd()
+	// are collected and sent as one SPI_IOC_MESSAGE with multiple segments.
+	class SpiSlave
+	{
+	public:
+		// Constructor
+		// cs_port, cs_pin .. unused, CS is handled by the spidev device
+		// max_clock .. max. SPI clock of the device in Hz (0 for the device default)
+		explicit SpiSlave(SPI_TypeDef * spi_instance, GPIO_TypeDef * cs_port,
+				uint16_t cs_pin, uint32_t max_clock = 0);
+
+		virtual ~SpiSlave();
+
+		// Returns true while an asynchronous transfer is in progress.
+		bool SpiBusy() const;
+
+		// Returns true if other is connected to the same SPI device.
+		bool SpiSameBus(const SpiSlave* other) const;
+
+		// Device priority, 0 by default. If SpiStart fails on a busy device, a
+		// slave with a priority above 0 reserves the device and it is handed over
+		// to the slave on release. Such a slave must retry until its transfer started.
+		void SetSpiPriority(uint8_t priority);
+		uint8_t SpiPriority() const;
+
+	private:
+		// SPI device
+		SpiDevice * device_;
+		// Max. clock of this device
+		uint32_t max_clock_;
+		// SPI mode and word size set by SpiConfig()
+		uint8_t mode_;
+		uint8_t bits_per_word_;
+		// Device priority
+		uint8_t priority_;
+		// State
+		bool transfer_started_;
+		// CS kept asserted after a flushed message
+		bool cs_held_;
+		// Segments of the pending message
+		struct spi_ioc_transfer segments_[SPI_SLAVE_MAX_SEGMENTS];
+		size_t segment_count_;
+
+		// Append a transfer segment to the pending message
+		bool SpiQueue(const uint8_t* txdata, uint8_t* rxdata, size_t size, bool cs_change);
+
+		// Send the pending message, keep_cs leaves CS asserted afterwards
+		bool SpiFlush(bool keep_cs);
+
+		// Release the device, hands it over to the reserving slave if any
+		void SpiRelease();
+
+	protected:
+
+		// Attempt to begin spi transfer, same as SpiAcquire() and SpiSelect().
+		// Returns false if another transfer on the same device already started.
+		bool SpiStart();
+
+		// Attempt to acquire the device and apply the configuration.
+		// Returns false if another transfer on the same device already started.
+		bool SpiAcquire();
+
+		// Begin the message after SpiAcquire(), CS is asserted by the kernel when it is sent.
+		// Returns false if the device is not acquired.
+		bool SpiSelect();
+
+		// Send the pending message and release CS.
+		// Returns false if the transfer failed.
+		// Returns true if no transfer started or successful.
+		bool SpiEnd();
+
+		// Write a block of data, sent with the next read or on SpiEnd().
+		// The data must stay valid until then.
+		// Returns false if no transfer started.
+		bool SpiWrite(uint8_t* data, size_t size);
+
+		// Read a block of data, pending writes are sent in the same message.
+		// Returns false if no transfer started.
+		bool SpiRead(uint8_t* data, size_t size);
+
+		// Transceive a block of data, pending writes are sent in the same message.
+		// Returns false if no transfer started.
+		bool SpiTransceive(uint8_t* txdata, uint8_t *rxdata, size_t size);
+
+		// Write a block of data and end the transfer, then invoke the callback.
+		// Returns false if no transfer started, the callback is not invoked then.
+		bool SpiWriteAsync(uint8_t* data, size_t size, SpiCallback callback = NULL, void* context = NULL);
+
+		// Transceive a block of data and end the transfer, then invoke the callback.
+		// Returns false if no transfer started, the callback is not invoked then.
+		bool SpiTransceiveAsync(uint8_t* txdata, uint8_t *rxdata, size_t size, SpiCallback callback = NULL, void* context = NULL);
+
+		// Write a chain of frames, each a length byte followed by the frame data,
+		// and end the transfer, then invoke the callback. CS is released between
+		// frames, up to SPI_SLAVE_MAX_SEGMENTS frames are sent in one message.
+		// Returns false if no transfer started or the chain is empty, the callback is not invoked then.
+		bool SpiWriteChainAsync(const uint8_t* chain, size_t size, SpiCallback callback = NULL, void* context = NULL);
+
+		// Configure SPI mode and word size, applied to the device on the next transfer.
+		bool SpiConfig(uint32_t data_size = SPI_DATASIZE_8BIT, uint32_t clk_polarity = SPI_POLARITY_LOW, uint32_t clk_phase = SPI_PHASE_1EDGE);
+
+	};
+
+}; // namespace bsp
+
+#endif /* SPISLAVE_H_ */
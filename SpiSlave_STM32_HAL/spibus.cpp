@@ -0,0 +1,227 @@
+/*
+ * spibus.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include <spibus.h>
+#include <spislave.h>
+
+#include <assert.h>
+
+// Declaration of static members
+bsp::SpiBus bsp::SpiBus::buses_[SPI_BUS_MAX_COUNT];
+uint8_t bsp::SpiBus::bus_count_ = 0;
+
+// Baud rate prescalers, index n divides the kernel clock by 2^(n+1)
+static const uint32_t spi_prescalers[] = {
+	SPI_BAUDRATEPRESCALER_2, SPI_BAUDRATEPRESCALER_4,
+	SPI_BAUDRATEPRESCALER_8, SPI_BAUDRATEPRESCALER_16,
+	SPI_BAUDRATEPRESCALER_32, SPI_BAUDRATEPRESCALER_64,
+	SPI_BAUDRATEPRESCALER_128, SPI_BAUDRATEPRESCALER_256
+};
+
+// Compare and swap of a slave pointer. Cortex-M3 and above use exclusive access,
+// the store is only retried if an interrupt intervened. The Cortex-M0 has no
+// LDREX / STREX, interrupts are disabled for the few instructions instead.
+static inline bool bus_compare_exchange(bsp::SpiSlave * volatile *word, bsp::SpiSlave *expected, bsp::SpiSlave *desired)
+{
+#if defined(__CORTEX_M) && (__CORTEX_M == 0U)
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	bool success = (*word == expected);
+	if (success)
+		*word = desired;
+
+	__set_PRIMASK(primask);
+	__DMB();
+
+	return success;
+#else
+	do {
+		if ((bsp::SpiSlave *)(uintptr_t)__LDREXW((volatile uint32_t *)word) != expected) {
+			__CLREX();
+			return false;
+		}
+	} while (__STREXW((uint32_t)(uintptr_t)desired, (volatile uint32_t *)word) != 0);
+
+	__DMB();
+
+	return true;
+#endif
+}
+
+// Swap a slave pointer, returns the previous value
+static inline bsp::SpiSlave* bus_exchange(bsp::SpiSlave * volatile *word, bsp::SpiSlave *desired)
+{
+	bsp::SpiSlave *previous;
+
+	do {
+		previous = *word;
+	} while (!bus_compare_exchange(word, previous, desired));
+
+	return previous;
+}
+
+bsp::SpiBus* bsp::SpiBus::Get(SPI_TypeDef *spi_instance)
+{
+	for (uint8_t i = 0; i < bus_count_; ++i) {
+		if (buses_[i].hspi_.Instance == spi_instance)
+			return &buses_[i];
+	}
+
+	if (bus_count_ >= SPI_BUS_MAX_COUNT)
+		return NULL;
+
+	// Buses are set up on first use, static storage is zero initialized before
+	// any constructor of a global SpiSlave instance runs.
+	SpiBus *bus = &buses_[bus_count_++];
+	bus->hspi_.Instance = spi_instance;
+	bus->configured_ = false;
+	bus->owner_ = NULL;
+	bus->reserved_ = NULL;
+
+	// non-changing SPI configuration
+	bus->hspi_.Init.Mode = SPI_MODE_MASTER;
+	bus->hspi_.Init.Direction = SPI_DIRECTION_2LINES;
+	bus->hspi_.Init.NSS = SPI_NSS_SOFT;
+	bus->hspi_.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;
+	bus->hspi_.Init.FirstBit = SPI_FIRSTBIT_MSB;
+	bus->hspi_.Init.TIMode = SPI_TIMODE_DISABLE;
+	bus->hspi_.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+	bus->hspi_.Init.CRCPolynomial = 7;
+	bus->hspi_.Init.CRCLength = SPI_CRC_LENGTH_DATASIZE;
+	bus->hspi_.Init.NSSPMode = SPI_NSS_PULSE_ENABLE;
+
+	return bus;
+}
+
+bsp::SpiBus* bsp::SpiBus::FromHandle(SPI_HandleTypeDef *hspi)
+{
+	for (uint8_t i = 0; i < bus_count_; ++i) {
+		if (&buses_[i].hspi_ == hspi)
+			return &buses_[i];
+	}
+
+	return NULL;
+}
+
+bool bsp::SpiBus::Configure(uint32_t data_size, uint32_t clk_polarity,
+		uint32_t clk_phase, uint32_t prescaler)
+{
+	// Skip if already applied
+	if (configured_ && (hspi_.Init.DataSize == data_size)
+			&& (hspi_.Init.CLKPolarity == clk_polarity)
+			&& (hspi_.Init.CLKPhase == clk_phase)
+			&& (hspi_.Init.BaudRatePrescaler == prescaler))
+		return true;
+
+	hspi_.Init.DataSize = data_size;
+	hspi_.Init.CLKPolarity = clk_polarity;
+	hspi_.Init.CLKPhase = clk_phase;
+	hspi_.Init.BaudRatePrescaler = prescaler;
+
+	configured_ = (HAL_SPI_Init(&hspi_) == HAL_OK);
+
+	return configured_;
+}
+
+void bsp::SpiBus::Invalidate()
+{
+	configured_ = false;
+}
+
+uint32_t bsp::SpiBus::PrescalerFromClock(uint32_t max_clock) const
+{
+	uint32_t fclk = ClockFrequency();
+	uint8_t i;
+
+	// Slowest setting if no prescaler is sufficient
+	for (i = 0; i < (sizeof(spi_prescalers) / sizeof(spi_prescalers[0])) - 1; ++i) {
+		if ((fclk >> (i + 1)) <= max_clock)
+			break;
+	}
+
+	return spi_prescalers[i];
+}
+
+uint32_t bsp::SpiBus::ClockFrequency() const
+{
+#if defined(RCC_CFGR_PPRE2)
+	// SPI1, SPI4, SPI5 and SPI6 are clocked by APB2 on devices with two APB buses
+	if (hspi_.Instance == SPI1)
+		return HAL_RCC_GetPCLK2Freq();
+#if defined(SPI4)
+	if (hspi_.Instance == SPI4)
+		return HAL_RCC_GetPCLK2Freq();
+#endif
+#if defined(SPI5)
+	if (hspi_.Instance == SPI5)
+		return HAL_RCC_GetPCLK2Freq();
+#endif
+#if defined(SPI6)
+	if (hspi_.Instance == SPI6)
+		return HAL_RCC_GetPCLK2Freq();
+#endif
+#endif
+
+	return HAL_RCC_GetPCLK1Freq();
+}
+
+SPI_HandleTypeDef* bsp::SpiBus::Handle()
+{
+	return &hspi_;
+}
+
+bool bsp::SpiBus::Acquire(SpiSlave *slave)
+{
+	assert(slave != NULL);
+
+	// Handed over by Release()
+	if (owner_ == slave)
+		return true;
+
+	if (!bus_compare_exchange(&owner_, NULL, slave))
+		return false;
+
+	// Acquired while idle, drop an own reservation
+	bus_compare_exchange(&reserved_, slave, NULL);
+
+	return true;
+}
+
+void bsp::SpiBus::Release(SpiSlave *slave)
+{
+	// Only the owner may release the bus
+	assert(owner_ == slave);
+	(void)slave;
+
+	// Hand over to the reserving slave or free the bus. Other slaves can not
+	// acquire in between, the bus is owned until the store.
+	SpiSlave *next = bus_exchange(&reserved_, NULL);
+
+	__DMB();
+	owner_ = next;
+}
+
+void bsp::SpiBus::Reserve(SpiSlave *slave)
+{
+	assert(slave != NULL);
+
+	SpiSlave *current;
+
+	do {
+		current = reserved_;
+
+		// Keep a reservation of the same or higher priority
+		if ((current == slave) || ((current != NULL) && (current->SpiPriority() >= slave->SpiPriority())))
+			return;
+	} while (!bus_compare_exchange(&reserved_, current, slave));
+}
+
+bsp::SpiSlave* bsp::SpiBus::Owner() const
+{
+	return owner_;
+}
@@ -0,0 +1,88 @@
+/*
+ * spibus.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef SPIBUS_H_
+#define SPIBUS_H_
+
+// Target definition in main.h file generated by CubeMX
+#include "main.h"
+
+// GCC integer types
+#include <stdint.h>
+
+// Max. number of SPI peripherals managed
+#define SPI_BUS_MAX_COUNT	6
+
+// Board support package namespace
+namespace bsp
+{
+	class SpiSlave;
+
+	// Configuration manager shared by all slave devices on one SPI peripheral.
+	// Remembers the applied configuration and only reinitializes the
+	// peripheral if a device requires different settings.
+	// Arbitrates the bus by an owner token, safe to use from tasks and interrupts.
+	class SpiBus
+	{
+	public:
+		// Get the bus of a SPI peripheral instance, created on first use.
+		// Returns NULL if more than SPI_BUS_MAX_COUNT peripherals are used.
+		static SpiBus* Get(SPI_TypeDef * spi_instance);
+
+		// Find the bus owning a HAL handle, returns NULL if unknown
+		static SpiBus* FromHandle(SPI_HandleTypeDef * hspi);
+
+		// Apply the configuration, HAL_SPI_Init is only called if it differs
+		// from the currently applied one.
+		bool Configure(uint32_t data_size, uint32_t clk_polarity, uint32_t clk_phase, uint32_t prescaler);
+
+		// Force reinitialization on the next Configure(), e.g. after the
+		// peripheral was reconfigured outside of this class.
+		void Invalidate();
+
+		// Smallest baud rate prescaler with a SPI clock not exceeding max_clock
+		uint32_t PrescalerFromClock(uint32_t max_clock) const;
+
+		// Kernel clock of the SPI peripheral in Hz
+		uint32_t ClockFrequency() const;
+
+		// HAL handle of the peripheral
+		SPI_HandleTypeDef* Handle();
+
+		// Take the bus for slave by a single compare and swap.
+		// Returns true if the bus was idle or handed over to slave by Release().
+		bool Acquire(SpiSlave* slave);
+
+		// Release the bus owned by slave. If a slave reserved the bus, ownership
+		// is handed over to it instead of freeing the bus.
+		void Release(SpiSlave* slave);
+
+		// Reserve the busy bus for slave, replaces a reservation of lower priority
+		// (see SpiSlave::SetSpiPriority). The reserving slave must retry Acquire()
+		// until it succeeds, the bus is held for it after the next Release().
+		void Reserve(SpiSlave* slave);
+
+		// Slave owning the bus, NULL if idle
+		SpiSlave* Owner() const;
+
+	private:
+		// SPI peripheral handle
+		SPI_HandleTypeDef hspi_;
+		// Handle initialized with the settings in hspi_.Init
+		bool configured_;
+		// Slave owning the bus and slave the bus is handed over to on release
+		SpiSlave * volatile owner_;
+		SpiSlave * volatile reserved_;
+
+		// Buses in use
+		static SpiBus buses_[SPI_BUS_MAX_COUNT];
+		static uint8_t bus_count_;
+	};
+
+}; // namespace bsp
+
+#endif /* SPIBUS_H_ */
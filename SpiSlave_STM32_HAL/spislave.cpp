@@ -7,16 +7,12 @@
 
 #include <spislave.h>
 
-// Declaration of static member
-std::set<bsp::SpiSlave const *> bsp::SpiSlave::instances_;
+#include <assert.h>
 
 bsp::SpiSlave::SpiSlave(SPI_TypeDef *spi_instance, GPIO_TypeDef *cs_port,
-		uint16_t cs_pin)
+		uint16_t cs_pin, uint32_t max_clock)
 {
-	// Add instance to set
-	bsp::SpiSlave::instances_.insert(this);
-
-	hspi_.Instance = spi_instance;
+	bus_ = SpiBus::Get(spi_instance);
 	cs_port_ = cs_port;
 	cs_pin_ = cs_pin;
 
@@ -25,42 +21,74 @@ bsp::SpiSlave::SpiSlave(SPI_TypeDef *spi_instance, GPIO_TypeDef *cs_port,
 
 	// No transfer started
 	transfer_started_ = false;
+	async_pending_ = false;
+	callback_ = NULL;
+	callback_context_ = NULL;
+	chain_ = NULL;
+	chain_end_ = NULL;
+
+	// Default configuration
+	data_size_ = SPI_DATASIZE_8BIT;
+	clk_polarity_ = SPI_POLARITY_LOW;
+	clk_phase_ = SPI_PHASE_1EDGE;
+	priority_ = 0;
+
+	// Too many SPI peripherals in use
+	assert(bus_ != NULL);
 
-	// non-changing SPI configuration
-	hspi_.Init.Mode = SPI_MODE_MASTER;
-	hspi_.Init.Direction = SPI_DIRECTION_2LINES;
-	hspi_.Init.NSS = SPI_NSS_SOFT;
-	hspi_.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;
-	hspi_.Init.FirstBit = SPI_FIRSTBIT_MSB;
-	hspi_.Init.TIMode = SPI_TIMODE_DISABLE;
-	hspi_.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
-	hspi_.Init.CRCPolynomial = 7;
-	hspi_.Init.CRCLength = SPI_CRC_LENGTH_DATASIZE;
-	hspi_.Init.NSSPMode = SPI_NSS_PULSE_ENABLE;
+	// Device clock limit, the prescaler is calculated on SpiAcquire() since the
+	// kernel clock may not be set up yet for global instances
+	max_clock_ = max_clock;
+	prescaler_ = SPI_BAUDRATEPRESCALER_8;
+	prescaler_clock_ = 0;
 }
 
-bsp::SpiSlave::~SpiSlave()
+bsp::SpiSlave::~SpiSlave() { }
+
+bool bsp::SpiSlave::SpiStart()
 {
-	// Remove instance from set
-	bsp::SpiSlave::instances_.erase(this);
+	return SpiAcquire() && SpiSelect();
 }
 
-bool bsp::SpiSlave::SpiStart()
+bool bsp::SpiSlave::SpiAcquire()
 {
-	// Check other instances in set
-	std::set<SpiSlave const *>::iterator i;
+	if (transfer_started_)
+		return false;
+
+	// Claim the bus, wait for the handover if prioritized
+	if (!bus_->Acquire(this)) {
+		if (priority_ > 0)
+			bus_->Reserve(this);
+
+		return false;
+	}
 
-	for (i = bsp::SpiSlave::instances_.begin(); i != bsp::SpiSlave::instances_.end(); ++i) {
-		// Resolve iterator
-		const SpiSlave *inst = *i;
+	// Recalculate the prescaler if the kernel clock changed
+	if (max_clock_ != 0) {
+		uint32_t clock = bus_->ClockFrequency();
 
-		// Check SPI peripheral instance and transfer started flag
-		if ((inst->hspi_.Instance == this->hspi_.Instance) && inst->transfer_started_)
-			return false;
+		if (clock != prescaler_clock_) {
+			prescaler_ = bus_->PrescalerFromClock(max_clock_);
+			prescaler_clock_ = clock;
+		}
+	}
+
+	// Apply the configuration of this slave, skipped by the bus if unchanged
+	if (!bus_->Configure(data_size_, clk_polarity_, clk_phase_, prescaler_)) {
+		bus_->Release(this);
+		return false;
 	}
 
 	transfer_started_ = true;
 
+	return true;
+}
+
+bool bsp::SpiSlave::SpiSelect()
+{
+	if (!transfer_started_)
+		return false;
+
 	// Pull CS pin
 	HAL_GPIO_WritePin(cs_port_, cs_pin_, GPIO_PIN_RESET);
 
@@ -71,12 +99,15 @@ bool bsp::SpiSlave::SpiEnd() {
 	if (!transfer_started_)
 		return true;
 
-	// TODO: With interrupt or DMA driven SPI this method needs to check for tx or rx complete flag.
+	// Asynchronous transfers are ended by the complete interrupt
+	if (async_pending_)
+		return false;
 
-	// At the moment HAL waits for SPI transfer complete automatically
+	// Blocking HAL calls wait for SPI transfer complete automatically
 	HAL_GPIO_WritePin(cs_port_, cs_pin_, GPIO_PIN_SET);
 
 	transfer_started_ = false;
+	bus_->Release(this);
 
 	return true;
 }
@@ -87,7 +118,7 @@ bool bsp::SpiSlave::SpiWrite(uint8_t *data, size_t size)
 		return false;
 
 	// write buffer and wait
-	HAL_SPI_Transmit(&hspi_, data, size, HAL_MAX_DELAY);
+	HAL_SPI_Transmit(bus_->Handle(), data, size, HAL_MAX_DELAY);
 
 	return true;
 }
@@ -98,7 +129,7 @@ bool bsp::SpiSlave::SpiRead(uint8_t *data, size_t size)
 		return false;
 
 	// read to buffer and wait
-	HAL_SPI_Receive(&hspi_, data, size, HAL_MAX_DELAY);
+	HAL_SPI_Receive(bus_->Handle(), data, size, HAL_MAX_DELAY);
 
 	return true;
 }
@@ -109,23 +140,139 @@ bool bsp::SpiSlave::SpiTransceive(uint8_t* txdata, uint8_t* rxdata, size_t size)
 		return false;
 
 	// read to buffer and wait
-	HAL_SPI_TransmitReceive(&hspi_, txdata, rxdata, size, HAL_MAX_DELAY);
+	HAL_SPI_TransmitReceive(bus_->Handle(), txdata, rxdata, size, HAL_MAX_DELAY);
 
 	return true;
 }
 
-bool bsp::SpiSlave::SpiConfig(uint32_t data_size, uint32_t clk_polarity,
-		uint32_t clk_phase)
+bool bsp::SpiSlave::SpiWriteAsync(uint8_t *data, size_t size, SpiCallback callback, void *context)
+{
+	if (!transfer_started_ || async_pending_)
+		return false;
+
+	callback_ = callback;
+	callback_context_ = context;
+	async_pending_ = true;
+
+	// start DMA, CS is released in the complete interrupt
+	if (HAL_SPI_Transmit_DMA(bus_->Handle(), data, size) != HAL_OK)
+	{
+		async_pending_ = false;
+		return false;
+	}
+
+	return true;
+}
+
+bool bsp::SpiSlave::SpiTransceiveAsync(uint8_t *txdata, uint8_t *rxdata, size_t size, SpiCallback callback, void *context)
 {
-	/* SPI1 parameter configuration*/
-	hspi_.Init.DataSize = data_size;
-	hspi_.Init.CLKPolarity = clk_polarity;
-	hspi_.Init.CLKPhase = clk_phase;
+	if (!transfer_started_ || async_pending_)
+		return false;
 
-	if (HAL_SPI_Init(&hspi_) != HAL_OK)
+	callback_ = callback;
+	callback_context_ = context;
+	async_pending_ = true;
+
+	// start DMA, CS is released in the complete interrupt
+	if (HAL_SPI_TransmitReceive_DMA(bus_->Handle(), txdata, rxdata, size) != HAL_OK)
 	{
+		async_pending_ = false;
 		return false;
 	}
 
 	return true;
 }
+
+bool bsp::SpiSlave::SpiWriteChainAsync(const uint8_t *chain, size_t size, SpiCallback callback, void *context)
+{
+	if (!transfer_started_ || async_pending_ || (size < 2))
+		return false;
+
+	// Remaining frames after the first one
+	chain_ = chain + chain[0] + 1;
+	chain_end_ = chain + size;
+
+	if (!SpiWriteAsync(const_cast<uint8_t *>(chain + 1), chain[0], callback, context))
+	{
+		chain_ = NULL;
+		return false;
+	}
+
+	return true;
+}
+
+bool bsp::SpiSlave::SpiBusy() const
+{
+	return async_pending_;
+}
+
+bool bsp::SpiSlave::SpiSameBus(const SpiSlave *other) const
+{
+	return (other != NULL) && (other->bus_ == bus_);
+}
+
+void bsp::SpiSlave::SetSpiPriority(uint8_t priority)
+{
+	priority_ = priority;
+}
+
+uint8_t bsp::SpiSlave::SpiPriority() const
+{
+	return priority_;
+}
+
+void bsp::SpiSlave::SpiAsyncComplete(bool success)
+{
+	// Continue a chained transfer with the next frame
+	if (success && (chain_ != NULL) && (chain_ < chain_end_))
+	{
+		const uint8_t *frame = chain_;
+		chain_ += frame[0] + 1;
+
+		HAL_GPIO_WritePin(cs_port_, cs_pin_, GPIO_PIN_SET);
+		HAL_GPIO_WritePin(cs_port_, cs_pin_, GPIO_PIN_RESET);
+
+		if (HAL_SPI_Transmit_DMA(bus_->Handle(), const_cast<uint8_t *>(frame + 1), frame[0]) == HAL_OK)
+			return;
+
+		success = false;
+	}
+
+	chain_ = NULL;
+
+	// Release CS and bus before the callback so it can start the next transfer
+	HAL_GPIO_WritePin(cs_port_, cs_pin_, GPIO_PIN_SET);
+
+	async_pending_ = false;
+	transfer_started_ = false;
+	bus_->Release(this);
+
+	if (callback_ != NULL)
+		callback_(callback_context_, success);
+}
+
+void bsp::SpiSlave::SpiIrqHandler(SPI_HandleTypeDef *hspi, bool success)
+{
+	SpiBus *bus = SpiBus::FromHandle(hspi);
+
+	if (bus == NULL)
+		return;
+
+	// The pending transfer belongs to the bus owner
+	SpiSlave *owner = bus->Owner();
+
+	if ((owner != NULL) && owner->async_pending_)
+		owner->SpiAsyncComplete(success);
+}
+
+bool bsp::SpiSlave::SpiConfig(uint32_t data_size, uint32_t clk_polarity,
+		uint32_t clk_phase)
+{
+	// Applied after acquiring the bus, HAL_SPI_Init is skipped if the bus is
+	// already configured for this device
+	data_size_ = data_size;
+	clk_polarity_ = clk_polarity;
+	clk_phase_ = clk_phase;
+
+	return true;
+}
@@ -13,41 +13,95 @@
 
 // GCC integer types
 #include <stdint.h>
-#include <set>
+
+#include <spibus.h>
 
 // Board support package namespace
 namespace bsp
 {
+	// Asynchronous transfer complete callback, called from interrupt context.
+	// An asynchronous call that returns false did not start and never invokes the callback,
+	// the caller ends the transfer with SpiEnd(). A call that returns true reports the
+	// result to the callback only. The Linux backend follows the same contract.
+	typedef void (*SpiCallback)(void* context, bool success);
+
 	// Class that gives basic SPI peripheral device data and methods.
-	// Prevents simultaneous bus access by multiple slave device drivers.
+	// Prevents simultaneous bus access by multiple slave device drivers, the bus
+	// is acquired wait-free and may be shared by tasks and interrupts.
 	class SpiSlave
 	{
 	public:
 		// Constructor
+		// max_clock .. max. SPI clock of the device in Hz (0 for the default prescaler 8)
 		explicit SpiSlave(SPI_TypeDef * spi_instance, GPIO_TypeDef * cs_port,
-				uint16_t cs_pin);
+				uint16_t cs_pin, uint32_t max_clock = 0);
 
 		virtual ~SpiSlave();
 
+		// Returns true while an asynchronous transfer is in progress.
+		bool SpiBusy() const;
+
+		// Returns true if other is connected to the same SPI peripheral.
+		bool SpiSameBus(const SpiSlave* other) const;
+
+		// Bus priority, 0 by default. If SpiStart fails on a busy bus, a slave
+		// with a priority above 0 reserves the bus and it is handed over to the
+		// slave on release, so lower priority slaves can not take it in between.
+		// Such a slave must retry until its transfer started.
+		void SetSpiPriority(uint8_t priority);
+		uint8_t SpiPriority() const;
+
+		// Completion handler for asynchronous transfers.
+		// Call from HAL_SPI_TxCpltCallback, HAL_SPI_TxRxCpltCallback (success = true)
+		// and HAL_SPI_ErrorCallback (success = false).
+		static void SpiIrqHandler(SPI_HandleTypeDef* hspi, bool success);
+
 	private:
 		// chip select port
 		GPIO_TypeDef * cs_port_;
 		// chip select pin
 		uint16_t cs_pin_;
-		// SPI peripheral instance
-		SPI_HandleTypeDef hspi_;
+		// SPI peripheral configuration shared with other devices on the bus
+		SpiBus * bus_;
+		// Max. SPI clock of the device, 0 for the default prescaler
+		uint32_t max_clock_;
+		// Baud rate prescaler for this device and the kernel clock it was calculated for
+		uint32_t prescaler_;
+		uint32_t prescaler_clock_;
+		// Configuration applied to the bus on SpiStart()
+		uint32_t data_size_;
+		uint32_t clk_polarity_;
+		uint32_t clk_phase_;
+		// Bus priority
+		uint8_t priority_;
 		// State
-		bool transfer_started_;
-
-		// Set of all instances to prevent same time activation
-		static std::set<SpiSlave const *> instances_;
+		volatile bool transfer_started_;
+		volatile bool async_pending_;
+		// Asynchronous transfer complete callback
+		SpiCallback callback_;
+		void* callback_context_;
+		// Remaining frames of a chained transfer
+		const uint8_t* chain_;
+		const uint8_t* chain_end_;
+
+		// Release CS and notify the callback of the pending asynchronous transfer
+		void SpiAsyncComplete(bool success);
 
 	protected:
 
-		// Attempt to begin spi transfer by pulling CS pin low.
+		// Attempt to begin spi transfer by acquiring the bus, applying the
+		// configuration and pulling CS pin low, same as SpiAcquire() and SpiSelect().
 		// Returns false if another transfer on the same peripheral already started.
 		bool SpiStart();
 
+		// Attempt to acquire the bus and apply the configuration, CS stays high.
+		// Returns false if another transfer on the same peripheral already started.
+		bool SpiAcquire();
+
+		// Pull CS pin low after SpiAcquire().
+		// Returns false if the bus is not acquired.
+		bool SpiSelect();
+
 		// Attempt to push the CS pin high.
 		// Returns false if transfer still in progress.
 		// Returns true if no transfer started or successful.
@@ -65,7 +119,25 @@ namespace bsp
 		// Returns false if no transfer started.
 		bool SpiTransceive(uint8_t* txdata, uint8_t *rxdata, size_t size);
 
-		// Configure the SPI peripheral
+		// Start writing a block of data by DMA and return immediately.
+		// CS is released and the callback invoked from the DMA complete interrupt.
+		// Returns false if no transfer started or the DMA could not be started.
+		bool SpiWriteAsync(uint8_t* data, size_t size, SpiCallback callback = NULL, void* context = NULL);
+
+		// Start transceiving a block of data by DMA and return immediately.
+		// CS is released and the callback invoked from the DMA complete interrupt.
+		// Returns false if no transfer started or the DMA could not be started.
+		bool SpiTransceiveAsync(uint8_t* txdata, uint8_t *rxdata, size_t size, SpiCallback callback = NULL, void* context = NULL);
+
+		// Start writing a chain of frames by DMA and return immediately.
+		// The chain is a sequence of frames, each a length byte followed by the frame data.
+		// CS is toggled between frames and the next frame started from the DMA complete
+		// interrupt, the callback is invoked after the last frame. The chain must stay
+		// valid until then. Returns false if no transfer started or the DMA could not be started.
+		bool SpiWriteChainAsync(const uint8_t* chain, size_t size, SpiCallback callback = NULL, void* context = NULL);
+
+		// Configure the SPI peripheral, applied on SpiStart(). The peripheral is
+		// only reinitialized if the current configuration of the bus differs.
 		bool SpiConfig(uint32_t data_size = SPI_DATASIZE_8BIT, uint32_t clk_polarity = SPI_POLARITY_LOW, uint32_t clk_phase = SPI_PHASE_1EDGE);
 
 	};
@@ -0,0 +1,82 @@
+/*
+ * test_async.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of the asynchronous writes of LMX2492Driver against LMX2492Simulator. The Linux
+ * backend completes a transfer before the asynchronous call returns.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_async.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_async && ./test_async
+ */
+
+#include <stdint.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+// Completion reported to the callback
+typedef struct {
+	uint32_t calls;
+	bool success;
+} TestCompletion;
+
+static void test_callback(void* context, bool success)
+{
+	TestCompletion* completion = (TestCompletion*)context;
+
+	++completion->calls;
+	completion->success = success;
+}
+
+// The callback runs once, the written data is known to the shadow
+static void test_write_async()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	TestCompletion completion = { 0, false };
+	const uint8_t data[2] = { 0x12, 0x34 };
+
+	CHECK(pll.WriteMemoryAsync(LMX2492_RAMP_CONFIG_ADDRESS + 6, data, 2, test_callback, &completion));
+	CHECK(completion.calls == 1);
+	CHECK(completion.success);
+	CHECK(sim.Register(LMX2492_RAMP_CONFIG_ADDRESS + 6) == data[0]);
+	CHECK(sim.Register(LMX2492_RAMP_CONFIG_ADDRESS + 7) == data[1]);
+
+	// Written data is not resent
+	sim.ResetCounters();
+	pll.StageMemory(LMX2492_RAMP_CONFIG_ADDRESS + 6, data, 2);
+
+	CHECK(pll.Commit());
+	CHECK(sim.Messages() == 0);
+}
+
+// A value staged after WriteMemoryAsync() returned, on a target while the DMA still runs,
+// is kept and written by the next Commit
+static void test_stage_during_async()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	const uint8_t data[2] = { 1, 2 };
+	uint8_t value = 9;
+
+	CHECK(pll.WriteMemoryAsync(LMX2492_RAMP_CONFIG_ADDRESS + 6, data, 2));
+	pll.StageMemory(LMX2492_RAMP_CONFIG_ADDRESS + 6, &value, 1);
+
+	CHECK(pll.Commit());
+	CHECK(sim.Register(LMX2492_RAMP_CONFIG_ADDRESS + 6) == value);
+	CHECK(sim.Register(LMX2492_RAMP_CONFIG_ADDRESS + 7) == data[1]);
+}
+
+int main()
+{
+	test_write_async();
+	test_stage_during_async();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,32 @@
+/*
+ * test_check.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Checks of the host tests. Each test is a program that prints the failed checks and
+ * returns TEST_RESULT(), the number of failures, as exit code.
+ */
+
+#ifndef TEST_CHECK_H_
+#define TEST_CHECK_H_
+
+#include <stdio.h>
+
+static int test_failures = 0;
+
+// Count and print a failed condition with the test function and line
+#define CHECK(condition) \
+	do { \
+		if(!(condition)) \
+		{ \
+			printf("FAIL %s:%d: %s\n", __func__, __LINE__, #condition); \
+			++test_failures; \
+		} \
+	} while(0)
+
+// Print the summary, returns the number of failures
+#define TEST_RESULT() \
+	(printf("%s: %d failures\n", (test_failures == 0) ? "PASS" : "FAIL", test_failures), test_failures)
+
+#endif /* TEST_CHECK_H_ */
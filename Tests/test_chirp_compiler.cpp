@@ -0,0 +1,255 @@
+/*
+ * test_chirp_compiler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of LMX2492ChirpCompiler::Compile().
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_chirp_compiler.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_chirp_compiler && ./test_chirp_compiler
+ */
+
+#include <stdint.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_fields.h"
+#include "lmx2492_chirp_compiler.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+// Ramp clock = fPFD = 32 MHz, 32 cycles per us
+#define TEST_FREF	32000000
+
+static uint32_t INC(const LMX2492ChirpCompiler& chirp, uint8_t slot) { return (uint32_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_INC>(&chirp.Ramps()[slot]); }
+static uint32_t LEN(const LMX2492ChirpCompiler& chirp, uint8_t slot) { return (uint32_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_LEN>(&chirp.Ramps()[slot]); }
+static uint8_t NEXT(const LMX2492ChirpCompiler& chirp, uint8_t slot) { return (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT>(&chirp.Ramps()[slot]); }
+static uint8_t RST(const LMX2492ChirpCompiler& chirp, uint8_t slot) { return (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_RST>(&chirp.Ramps()[slot]); }
+static uint8_t TRIG(const LMX2492ChirpCompiler& chirp, uint8_t slot) { return (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(&chirp.Ramps()[slot]); }
+
+// 5 ms = 160000 cycles do not fit one LEN, split into 3 slots of equal INC
+static void test_split()
+{
+	LMX2492ChirpCompiler chirp(TEST_FREF);
+	LMX2492_Chirp_Segment_TypeDef program[] = { LMX2492ChirpCompiler::Sweep(100000000, 5000000) };
+
+	CHECK(chirp.Compile(program, 1));
+	CHECK(chirp.Slots() == 4);
+	CHECK(chirp.FirstSlot(0) == 0);
+
+	CHECK(LEN(chirp, 0) == 53334);
+	CHECK(LEN(chirp, 1) == 53333);
+	CHECK(LEN(chirp, 2) == 53333);
+	CHECK(INC(chirp, 0) != 0);
+	CHECK(INC(chirp, 1) == INC(chirp, 0));
+	CHECK(INC(chirp, 2) == INC(chirp, 0));
+	CHECK(NEXT(chirp, 0) == 1);
+	CHECK(NEXT(chirp, 1) == 2);
+	CHECK(NEXT(chirp, 2) == 3);
+
+	// INC = 100 MHz / 32 MHz * 2^24 / 160000 = 327.68
+	CHECK(INC(chirp, 0) == 328);
+	CHECK(chirp.FrequencyError(0) == LMX2492Driver::RampDeltaHz(328, 160000, TEST_FREF) - 100000000000LL);
+	CHECK(chirp.TimingError(0) == 0);
+
+	// The program ends in a hold slot at the final frequency
+	CHECK(INC(chirp, 3) == 0);
+	CHECK(LEN(chirp, 3) == LMX2492_CHIRP_WAIT_LEN);
+	CHECK(NEXT(chirp, 3) == 3);
+}
+
+// The error of a sweep is corrected by the following sweeps
+static void test_error_carry()
+{
+	LMX2492ChirpCompiler chirp(TEST_FREF);
+	// 10 us = 320 cycles, one INC step is 32 MHz * 320 / 2^24 = 610.35 Hz
+	LMX2492_Chirp_Segment_TypeDef program[] = {
+		LMX2492ChirpCompiler::Sweep(1000000, 10000),
+		LMX2492ChirpCompiler::Sweep(1000000, 10000),
+		LMX2492ChirpCompiler::Sweep(1000000, 10000),
+		LMX2492ChirpCompiler::Sweep(-3000000, 10000),
+	};
+
+	CHECK(chirp.Compile(program, 4));
+	CHECK(chirp.Slots() == 5);
+
+	int64_t achieved = 0;
+	int64_t requested = 0;
+
+	for(size_t i = 0; i < 4; ++i)
+	{
+		uint8_t slot = chirp.FirstSlot(i);
+		CHECK(slot == i);
+		CHECK(LEN(chirp, slot) == 320);
+
+		achieved += LMX2492Driver::RampDeltaHz(INC(chirp, slot), 320, TEST_FREF);
+		requested += program[i].df * 1000;
+
+		// Achieved minus requested frequency, within half an INC step
+		CHECK(chirp.FrequencyError(i) == achieved - requested);
+		CHECK((chirp.FrequencyError(i) <= 305176) && (chirp.FrequencyError(i) >= -305176));
+	}
+
+	// 1 MHz = 1638.4 steps: the second sweep takes the carried error into account
+	CHECK(INC(chirp, 0) == 1638);
+	CHECK(INC(chirp, 1) == 1639);
+
+	// Negative sweeps are 30 bit two's complement
+	CHECK(INC(chirp, 3) & 0x20000000);
+}
+
+// A WAIT gets an own hold slot unless the preceding slot holds the frequency
+static void test_wait()
+{
+	LMX2492ChirpCompiler chirp(TEST_FREF);
+	LMX2492_Chirp_Segment_TypeDef program[] = {
+		LMX2492ChirpCompiler::Wait(LMX2492_RAMPx_NEXT_TRIG_TRIG_A),
+		LMX2492ChirpCompiler::Sweep(1000000, 10000),
+		LMX2492ChirpCompiler::Wait(LMX2492_RAMPx_NEXT_TRIG_TRIG_B),
+		LMX2492ChirpCompiler::Hold(1000),
+		LMX2492ChirpCompiler::Wait(LMX2492_RAMPx_NEXT_TRIG_TRIG_C),
+		LMX2492ChirpCompiler::Wait(LMX2492_RAMPx_NEXT_TRIG_TRIG_A),
+	};
+
+	CHECK(chirp.Compile(program, 6));
+	CHECK(chirp.Slots() == 6);
+
+	// Program start
+	CHECK(chirp.FirstSlot(0) == 0);
+	CHECK((INC(chirp, 0) == 0) && (LEN(chirp, 0) == LMX2492_CHIRP_WAIT_LEN));
+	CHECK(TRIG(chirp, 0) == LMX2492_RAMPx_NEXT_TRIG_TRIG_A);
+
+	// After a sweep, the sweep slot does not wait
+	CHECK(INC(chirp, 1) != 0);
+	CHECK(TRIG(chirp, 1) == LMX2492_RAMPx_NEXT_TRIG_NONE);
+	CHECK(chirp.FirstSlot(2) == 2);
+	CHECK((INC(chirp, 2) == 0) && (LEN(chirp, 2) == LMX2492_CHIRP_WAIT_LEN));
+	CHECK(TRIG(chirp, 2) == LMX2492_RAMPx_NEXT_TRIG_TRIG_B);
+
+	// After a hold, attached to the hold slot
+	CHECK((INC(chirp, 3) == 0) && (LEN(chirp, 3) == 32));
+	CHECK(chirp.FirstSlot(4) == 4);
+	CHECK(TRIG(chirp, 3) == LMX2492_RAMPx_NEXT_TRIG_TRIG_C);
+
+	// After another wait
+	CHECK((INC(chirp, 4) == 0) && (LEN(chirp, 4) == LMX2492_CHIRP_WAIT_LEN));
+	CHECK(TRIG(chirp, 4) == LMX2492_RAMPx_NEXT_TRIG_TRIG_A);
+
+	// The final hold does not wait again
+	CHECK(TRIG(chirp, 5) == LMX2492_RAMPx_NEXT_TRIG_NONE);
+	CHECK(NEXT(chirp, 5) == 5);
+
+	// Invalid trigger
+	LMX2492_Chirp_Segment_TypeDef invalid[] = { LMX2492ChirpCompiler::Wait(LMX2492_RAMPx_NEXT_TRIG_NONE) };
+	CHECK(!chirp.Compile(invalid, 1));
+}
+
+// A LOOP jumps back from the last slot and sets RST on the target slot
+static void test_loop()
+{
+	LMX2492ChirpCompiler chirp(TEST_FREF);
+	LMX2492_Chirp_Segment_TypeDef program[] = {
+		LMX2492ChirpCompiler::Hold(1000),
+		LMX2492ChirpCompiler::Sweep(1000000, 10000),
+		LMX2492ChirpCompiler::Sweep(-1000000, 10000),
+		LMX2492ChirpCompiler::Loop(1),
+	};
+
+	CHECK(chirp.Compile(program, 4));
+	CHECK(chirp.Slots() == 3);
+	CHECK(NEXT(chirp, 0) == 1);
+	CHECK(NEXT(chirp, 1) == 2);
+	CHECK(NEXT(chirp, 2) == 1);
+	CHECK(RST(chirp, 0) == LMX2492_RAMPx_RST_DISABLE);
+	CHECK(RST(chirp, 1) == LMX2492_RAMPx_RST_ENABLE);
+	CHECK(RST(chirp, 2) == LMX2492_RAMPx_RST_DISABLE);
+
+	// Without reset
+	program[3] = LMX2492ChirpCompiler::Loop(0, LMX2492_RAMPx_RST_DISABLE);
+	CHECK(chirp.Compile(program, 4));
+	CHECK(NEXT(chirp, 2) == 0);
+	CHECK(RST(chirp, 0) == LMX2492_RAMPx_RST_DISABLE);
+
+	// A WAIT loop target gets an own slot
+	LMX2492_Chirp_Segment_TypeDef wait_loop[] = {
+		LMX2492ChirpCompiler::Hold(1000),
+		LMX2492ChirpCompiler::Wait(LMX2492_RAMPx_NEXT_TRIG_TRIG_A),
+		LMX2492ChirpCompiler::Sweep(1000000, 10000),
+		LMX2492ChirpCompiler::Loop(1),
+	};
+
+	CHECK(chirp.Compile(wait_loop, 4));
+	CHECK(chirp.Slots() == 3);
+	CHECK(chirp.FirstSlot(1) == 1);
+	CHECK(TRIG(chirp, 0) == LMX2492_RAMPx_NEXT_TRIG_NONE);
+	CHECK(TRIG(chirp, 1) == LMX2492_RAMPx_NEXT_TRIG_TRIG_A);
+	CHECK(RST(chirp, 1) == LMX2492_RAMPx_RST_ENABLE);
+	CHECK(NEXT(chirp, 2) == 1);
+
+	// Only the last segment may loop, and only backwards
+	LMX2492_Chirp_Segment_TypeDef not_last[] = { LMX2492ChirpCompiler::Hold(1000), LMX2492ChirpCompiler::Loop(0), LMX2492ChirpCompiler::Hold(1000) };
+	CHECK(!chirp.Compile(not_last, 3));
+
+	LMX2492_Chirp_Segment_TypeDef forward[] = { LMX2492ChirpCompiler::Hold(1000), LMX2492ChirpCompiler::Loop(1) };
+	CHECK(!chirp.Compile(forward, 2));
+}
+
+// Programs that do not fit the eight slots or the 30 bit INC
+static void test_reject()
+{
+	LMX2492ChirpCompiler chirp(TEST_FREF);
+	LMX2492_Chirp_Segment_TypeDef program[LMX2492_CHIRP_MAX_SEGMENTS];
+
+	// Eight slots fit, nine do not
+	for(size_t i = 0; i < 9; ++i)
+		program[i] = LMX2492ChirpCompiler::Hold(1000);
+
+	CHECK(chirp.Compile(program, 8));
+	CHECK(chirp.Slots() == 8);
+	CHECK(!chirp.Compile(program, 9));
+
+	// The final hold slot counts
+	program[7] = LMX2492ChirpCompiler::Sweep(1000000, 1000);
+	CHECK(!chirp.Compile(program, 8));
+
+	// 8 * 65535 cycles fit, one more does not
+	program[0] = LMX2492ChirpCompiler::Hold(16383750);
+	program[1] = LMX2492ChirpCompiler::Loop(0);
+	CHECK(chirp.Compile(program, 2));
+	CHECK(chirp.Slots() == 8);
+
+	program[0] = LMX2492ChirpCompiler::Hold(16383782);
+	CHECK(!chirp.Compile(program, 2));
+
+	// INC = df / fPFD * 2^24 per cycle must stay below 2^29
+	program[0] = LMX2492ChirpCompiler::Sweep(1000000000, 31);
+	CHECK(chirp.Compile(program, 2));
+	CHECK(INC(chirp, 0) == 524288000);
+
+	program[0] = LMX2492ChirpCompiler::Sweep(-1000000000, 31);
+	CHECK(chirp.Compile(program, 2));
+	CHECK(INC(chirp, 0) == 0x40000000 - 524288000);
+
+	program[0] = LMX2492ChirpCompiler::Sweep(1023999999, 31);
+	CHECK(chirp.Compile(program, 2));
+	CHECK(INC(chirp, 0) == 0x1FFFFFFF);
+
+	program[0] = LMX2492ChirpCompiler::Sweep(1024000000, 31);
+	CHECK(!chirp.Compile(program, 2));
+
+	program[0] = LMX2492ChirpCompiler::Sweep(-1100000000, 31);
+	CHECK(!chirp.Compile(program, 2));
+}
+
+int main()
+{
+	test_split();
+	test_error_carry();
+	test_wait();
+	test_loop();
+	test_reject();
+
+	return TEST_RESULT();
+}
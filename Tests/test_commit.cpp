@@ -0,0 +1,103 @@
+/*
+ * test_commit.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of LMX2492Driver::Commit() against LMX2492Simulator: dirty range writes,
+ * register order and the PLL_N[7:0] latch of the double buffered registers.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_commit.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_commit && ./test_commit
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+#define TEST_FREF	32000000
+#define TEST_FOUT	1600000000ULL
+
+static void test_config(LMX2492_Config_TypeDef* config, uint64_t fout)
+{
+	LMX2492Driver::SimpleConfigHz(config, fout, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+}
+
+// A config is latched, register order is top down and unchanged registers are not resent
+static void test_commit()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492_Config_TypeDef config;
+
+	test_config(&config, TEST_FOUT);
+	pll.StageConfig(&config);
+
+	CHECK(pll.Commit());
+	CHECK(!sim.LatchPending());
+	CHECK(sim.OrderViolations() == 0);
+	CHECK(fabs(sim.Frequency(TEST_FREF) - (double)TEST_FOUT) < 1.0);
+
+	// Nothing changed
+	sim.ResetCounters();
+	pll.StageConfig(&config);
+
+	CHECK(pll.Commit());
+	CHECK(sim.Messages() == 0);
+
+	// One changed byte is one frame
+	uint8_t cpg = sim.Register(0x1C) ^ 0x01;
+	pll.StageMemory(0x1C, &cpg, 1);
+
+	CHECK(pll.Commit());
+	CHECK(sim.Frames() == 1);
+	CHECK(sim.WrittenBytes() == 1);
+	CHECK(sim.Register(0x1C) == cpg);
+}
+
+// A buffered register staged alone is latched by rewriting PLL_N[7:0] after it
+static void test_commit_latch()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492_Config_TypeDef config;
+
+	test_config(&config, TEST_FOUT);
+	pll.StageConfig(&config);
+	CHECK(pll.Commit());
+
+	uint32_t N = sim.PLL_N();
+
+	sim.ResetOrder();
+	pll.StageField<LMX2492_FIELD_FRAC_NUM>(0x123456);
+
+	CHECK(pll.Commit());
+	CHECK(!sim.LatchPending());
+	CHECK(sim.FracNum() == 0x123456);
+	CHECK(sim.PLL_N() == N);
+	CHECK(sim.OrderViolations() == 0);
+
+	// Same for raw bytes in 0x11 ... 0x18
+	uint8_t den = 0x77;
+	sim.ResetOrder();
+	pll.StageMemory(LMX2492_PLL_BUFFERED_LAST_ADDRESS, &den, 1);
+
+	CHECK(pll.Commit());
+	CHECK(!sim.LatchPending());
+	CHECK((sim.FracDen() >> 16) == den);
+	CHECK(sim.OrderViolations() == 0);
+}
+
+int main()
+{
+	test_commit();
+	test_commit_latch();
+
+	return TEST_RESULT();
+}
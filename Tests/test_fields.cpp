@@ -0,0 +1,239 @@
+/*
+ * test_fields.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host check of the field table in lmx2492_fields.h against the bitfields of the regdef
+ * structs. Every struct member is written once through the struct and once through
+ * LMX2492FieldSet, both byte images must be identical, and LMX2492FieldGet must read the
+ * member back. The checked members must cover all table bits of the struct address range.
+ * The ramp slots 1 ... 7 must repeat the parts of slot 0 at 7 byte steps.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 Tests/test_fields.cpp LMX2492/lmx2492_fields.cpp \
+ *       -o test_fields && ./test_fields
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "lmx2492_regdef.h"
+#include "lmx2492_fields.h"
+
+using namespace bsp;
+
+#define TEST_PATTERNS	64
+
+static int failures = 0;
+
+static void check(bool ok, const char* what, const char* name)
+{
+	if(!ok)
+	{
+		printf("FAIL %s: %s\n", what, name);
+		++failures;
+	}
+}
+
+// Set a struct member and the field bits lsb ... lsb + width - 1 to the same value, compare
+#define CHECK_MEMBER(Type, base, member, width, field, lsb) \
+	do { \
+		for(uint32_t pattern = 0; pattern < TEST_PATTERNS; ++pattern) \
+		{ \
+			uint64_t value = (pattern == 0) ? ~0ull : (uint64_t)rand(); \
+			value &= (1ull << (width)) - 1ull; \
+			Type regdef; \
+			uint8_t encoded[sizeof(Type)]; \
+			memset(&regdef, 0, sizeof(regdef)); \
+			memset(encoded, 0, sizeof(encoded)); \
+			regdef.member = value; \
+			LMX2492FieldSet<LMX2492_FIELD_##field>(encoded, (base), value << (lsb)); \
+			check(memcmp(&regdef, encoded, sizeof(Type)) == 0, "set", #member); \
+			check(((LMX2492FieldGet<LMX2492_FIELD_##field>((const uint8_t*)&regdef, (base)) >> (lsb)) & ((1ull << (width)) - 1ull)) == value, "get", #member); \
+		} \
+		checked_bits += (width); \
+	} while(0)
+
+// Table bits in the address range of a struct
+static uint32_t table_bits(uint16_t first, uint16_t last)
+{
+	uint32_t bits = 0;
+
+	for(uint16_t i = 0; i < LMX2492_FIELD_PART_COUNT; ++i)
+	{
+		if((LMX2492_FIELD_PARTS[i].address >= first) && (LMX2492_FIELD_PARTS[i].address <= last))
+			bits += LMX2492_FIELD_PARTS[i].width;
+	}
+
+	return bits;
+}
+
+static void check_config()
+{
+	uint32_t checked_bits = 0;
+	const uint16_t base = LMX2492_CONFIG_ADDRESS;
+
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, PLL_N_7_0, 8, PLL_N, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, PLL_N_15_8, 8, PLL_N, 8);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, PLL_N_17_16, 2, PLL_N, 16);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FRAC_DITHER, 2, FRAC_DITHER, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FRAC_ORDER, 3, FRAC_ORDER, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FRAC_NUM_7_0, 8, FRAC_NUM, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FRAC_NUM_15_8, 8, FRAC_NUM, 8);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FRAC_NUM_23_16, 8, FRAC_NUM, 16);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FRAC_DEN_7_0, 8, FRAC_DEN, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FRAC_DEN_15_8, 8, FRAC_DEN, 8);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FRAC_DEN_23_16, 8, FRAC_DEN, 16);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, PLL_R_7_0, 8, PLL_R, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, PLL_R_15_8, 8, PLL_R, 8);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, OSC_2X, 1, OSC_2X, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, PLL_R_DIFF, 1, PLL_R_DIFF, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, PFD_DLY, 2, PFD_DLY, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FL_CSR, 2, FL_CSR, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, CPG, 5, CPG, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, CPPOL, 1, CPPOL, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FL_CPG, 5, FL_CPG, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FL_TOC_10_8, 3, FL_TOC, 8);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, CMP_THR_LOW, 6, CMP_THR_LOW, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, CMP_FLAGL, 1, CMP_FLAGL, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, CMP_THR_HIGH, 6, CMP_THR_HIGH, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, CMP_FLAGH, 1, CMP_FLAGH, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, FL_TOC_7_0, 8, FL_TOC, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, DLD_PASS_CNT, 8, DLD_PASS_CNT, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, DLD_ERR_CNTR, 5, DLD_ERR_CNTR, 0);
+	CHECK_MEMBER(LMX2492_Config_TypeDef, base, DLD_TOL, 3, DLD_TOL, 0);
+
+	check(checked_bits == table_bits(LMX2492_CONFIG_ADDRESS, LMX2492_CONFIG_LAST_ADDRESS), "coverage", "LMX2492_Config_TypeDef");
+}
+
+static void check_gpio_config()
+{
+	uint32_t checked_bits = 0;
+	const uint16_t base = LMX2492_GPIO_CONFIG_ADDRESS;
+
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, _0x23b2_0, 3, GPIO_RESERVED_2_0, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, TRIG1_MUX_5, 1, TRIG1_MUX, 5);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, TRIG2_MUX_5, 1, TRIG2_MUX, 5);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, MUXout_MUX_5, 1, MUXout_MUX, 5);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, _0x23b6, 1, GPIO_RESERVED_6, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, MOD_MUX_5, 1, MOD_MUX, 5);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, TRIG1_PIN, 3, TRIG1_PIN, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, TRIG1_MUX_4_0, 5, TRIG1_MUX, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, TRIG2_PIN, 3, TRIG2_PIN, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, TRIG2_MUX_4_0, 5, TRIG2_MUX, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, MOD_PIN, 3, MOD_PIN, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, MOD_MUX_4_0, 5, MOD_MUX, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, MUXout_PIN, 3, MUXout_PIN, 0);
+	CHECK_MEMBER(LMX2492_GPIO_Config_TypeDef, base, MUXout_MUX_4_0, 5, MUXout_MUX, 0);
+
+	check(checked_bits == table_bits(LMX2492_GPIO_CONFIG_ADDRESS, LMX2492_GPIO_CONFIG_LAST_ADDRESS), "coverage", "LMX2492_GPIO_Config_TypeDef");
+}
+
+static void check_ramp_config()
+{
+	uint32_t checked_bits = 0;
+	const uint16_t base = LMX2492_RAMP_CONFIG_ADDRESS;
+
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_EN, 1, RAMP_EN, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CLK, 1, RAMP_CLK, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_PM_EN, 1, RAMP_PM_EN, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_TRIG_A, 4, RAMP_TRIG_A, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_TRIG_B, 4, RAMP_TRIG_B, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_TRIG_C, 4, RAMP_TRIG_C, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP0_7_0, 8, RAMP_CMP0, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP0_15_8, 8, RAMP_CMP0, 8);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP0_23_16, 8, RAMP_CMP0, 16);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP0_31_24, 8, RAMP_CMP0, 24);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP0_EN, 8, RAMP_CMP0_EN, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP1_7_0, 8, RAMP_CMP1, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP1_15_8, 8, RAMP_CMP1, 8);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP1_23_16, 8, RAMP_CMP1, 16);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP1_31_24, 8, RAMP_CMP1, 24);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP1_EN, 8, RAMP_CMP1_EN, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP0_32, 1, RAMP_CMP0, 32);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_CMP1_32, 1, RAMP_CMP1, 32);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, FSK_DEV_32, 1, FSK_DEV, 32);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_LOW_32, 1, RAMP_LIMIT_LOW, 32);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_HIGH_32, 1, RAMP_LIMIT_HIGH, 32);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, FSK_TRIG, 2, FSK_TRIG, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, FSK_DEV_7_0, 8, FSK_DEV, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, FSK_DEV_15_8, 8, FSK_DEV, 8);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, FSK_DEV_23_16, 8, FSK_DEV, 16);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, FSK_DEV_31_24, 8, FSK_DEV, 24);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_LOW_7_0, 8, RAMP_LIMIT_LOW, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_LOW_15_8, 8, RAMP_LIMIT_LOW, 8);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_LOW_23_16, 8, RAMP_LIMIT_LOW, 16);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_LOW_31_24, 8, RAMP_LIMIT_LOW, 24);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_HIGH_7_0, 8, RAMP_LIMIT_HIGH, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_HIGH_15_8, 8, RAMP_LIMIT_HIGH, 8);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_HIGH_23_16, 8, RAMP_LIMIT_HIGH, 16);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_LIMIT_HIGH_31_24, 8, RAMP_LIMIT_HIGH, 24);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_COUNT_7_0, 8, RAMP_COUNT, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_COUNT_12_8, 5, RAMP_COUNT, 8);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_AUTO, 1, RAMP_AUTO, 0);
+	CHECK_MEMBER(LMX2492_Ramp_Config_TypeDef, base, RAMP_TRIG_INC, 2, RAMP_TRIG_INC, 0);
+
+	check(checked_bits == table_bits(LMX2492_RAMP_CONFIG_ADDRESS, LMX2492_RAMP_CONFIG_LAST_ADDRESS), "coverage", "LMX2492_Ramp_Config_TypeDef");
+}
+
+static void check_ramp()
+{
+	uint32_t checked_bits = 0;
+	const uint16_t base = LMX2492_RAMP_ADDRESS(0);
+
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_INC_7_0, 8, RAMP0_INC, 0);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_INC_15_8, 8, RAMP0_INC, 8);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_INC_23_16, 8, RAMP0_INC, 16);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_INC_29_24, 6, RAMP0_INC, 24);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_FL, 1, RAMP0_FL, 0);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_DLY, 1, RAMP0_DLY, 0);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_LEN_7_0, 8, RAMP0_LEN, 0);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_LEN_15_8, 8, RAMP0_LEN, 8);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_FLAG, 2, RAMP0_FLAG, 0);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_RST, 1, RAMP0_RST, 0);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_NEXT_TRIG, 2, RAMP0_NEXT_TRIG, 0);
+	CHECK_MEMBER(LMX2492_Ramp_TypeDef, base, RAMPx_NEXT, 3, RAMP0_NEXT, 0);
+
+	check(checked_bits == table_bits(LMX2492_RAMP_ADDRESS(0), LMX2492_RAMP_LAST_ADDRESS(0)), "coverage", "LMX2492_Ramp_TypeDef");
+
+	// Slots 1 ... 7 are slot 0 moved by the slot size
+	for(uint8_t x = 1; x < LMX2492_RAMP_COUNT; ++x)
+	{
+		for(uint8_t field = LMX2492_FIELD_RAMPx(INC, 0); field < LMX2492_FIELD_RAMPx(INC, 1); ++field)
+		{
+			const LMX2492_Field_TypeDef* slot0 = LMX2492FieldDescriptor(field);
+			const LMX2492_Field_TypeDef* slotx = LMX2492FieldDescriptor(field + LMX2492_RAMP_FIELD_COUNT * x);
+			bool same = (slot0->parts == slotx->parts);
+
+			for(uint8_t i = 0; same && (i < slot0->parts); ++i)
+			{
+				const LMX2492_Field_Part_TypeDef &p0 = LMX2492_FIELD_PARTS[slot0->first + i];
+				const LMX2492_Field_Part_TypeDef &px = LMX2492_FIELD_PARTS[slotx->first + i];
+
+				same = (px.address == p0.address + sizeof(LMX2492_Ramp_TypeDef) * x) && (px.offset == p0.offset)
+						&& (px.width == p0.width) && (px.lsb == p0.lsb);
+			}
+
+			check(same, "slot", slotx->name);
+		}
+	}
+}
+
+int main()
+{
+	srand(2492);
+
+	check(LMX2492FieldListValid(), "list", "LMX2492_FIELD_PART_LIST");
+
+	check_config();
+	check_gpio_config();
+	check_ramp_config();
+	check_ramp();
+
+	printf("%s: %d failures\n", (failures == 0) ? "PASS" : "FAIL", failures);
+
+	return failures;
+}
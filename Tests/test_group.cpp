@@ -0,0 +1,225 @@
+/*
+ * test_group.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of LMX2492Group::Commit() with SpiBroadcastDevice on two LMX2492Simulator devices.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_group.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_group && ./test_group
+ */
+
+#include <stdint.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_group.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+#define TEST_FREF	32000000
+#define TEST_FOUT	1600000000ULL
+
+// Broadcast device counting its messages
+class TestBroadcastDevice : public SpiBroadcastDevice
+{
+public:
+	TestBroadcastDevice(SpiDevice* const* devices, size_t count) : SpiBroadcastDevice(devices, count), messages(0) { }
+
+	virtual bool Transfer(const struct spi_ioc_transfer* segments, size_t count)
+	{
+		++messages;
+
+		return SpiBroadcastDevice::Transfer(segments, count);
+	}
+
+	uint32_t messages;
+};
+
+// Slave holding a device between SpiStart() and SpiEnd()
+class TestHolder : public SpiSlave
+{
+public:
+	explicit TestHolder(SpiDevice* device) : SpiSlave(device, NULL, 0) { }
+
+	using SpiSlave::SpiStart;
+	using SpiSlave::SpiEnd;
+};
+
+typedef struct {
+	LMX2492Simulator sim[2];
+	SpiDevice* members[2];
+	TestBroadcastDevice* bc;
+	LMX2492Driver* broadcast;
+	LMX2492Driver* devices[2];
+	LMX2492Group* group;
+} TestGroup;
+
+static void test_setup(TestGroup* t)
+{
+	t->members[0] = &t->sim[0];
+	t->members[1] = &t->sim[1];
+	t->bc = new TestBroadcastDevice(t->members, 2);
+	t->broadcast = new LMX2492Driver(t->bc, NULL, 0);
+	t->devices[0] = new LMX2492Driver(&t->sim[0], NULL, 0);
+	t->devices[1] = new LMX2492Driver(&t->sim[1], NULL, 0);
+	t->group = new LMX2492Group(t->broadcast, t->devices, 2);
+}
+
+static void test_teardown(TestGroup* t)
+{
+	delete t->group;
+	delete t->devices[1];
+	delete t->devices[0];
+	delete t->broadcast;
+	delete t->bc;
+}
+
+static void test_reset_counters(TestGroup* t)
+{
+	t->bc->messages = 0;
+	t->sim[0].ResetCounters();
+	t->sim[1].ResetCounters();
+}
+
+static void test_config(LMX2492_Config_TypeDef* config, uint64_t fout)
+{
+	LMX2492Driver::SimpleConfigHz(config, fout, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+}
+
+// Device registers equal the config
+static bool test_holds(const LMX2492Simulator& sim, const LMX2492_Config_TypeDef* config)
+{
+	const uint8_t *data = (const uint8_t*)config;
+
+	for(size_t i = 0; i < sizeof(LMX2492_Config_TypeDef); ++i)
+	{
+		if(sim.Register(LMX2492_CONFIG_ADDRESS + i) != data[i])
+			return false;
+	}
+
+	return true;
+}
+
+// A config staged equal in both devices is only broadcast
+static void test_common()
+{
+	TestGroup t;
+	LMX2492_Config_TypeDef config;
+
+	test_setup(&t);
+	test_config(&config, TEST_FOUT);
+	t.group->StageConfig(&config);
+
+	CHECK(t.group->Commit());
+	CHECK(t.bc->messages > 0);
+	CHECK(t.sim[0].Messages() == t.bc->messages);
+	CHECK(t.sim[1].Messages() == t.bc->messages);
+	CHECK(t.sim[0].WrittenBytes() == sizeof(LMX2492_Config_TypeDef));
+	CHECK(test_holds(t.sim[0], &config));
+	CHECK(test_holds(t.sim[1], &config));
+
+	// The shadows of both devices hold the config
+	test_reset_counters(&t);
+	t.group->StageConfig(&config);
+
+	CHECK(t.group->Commit());
+	CHECK(t.bc->messages == 0);
+	CHECK(t.sim[0].Messages() == 0);
+	CHECK(t.sim[1].Messages() == 0);
+
+	test_teardown(&t);
+}
+
+// Differing dividers are written per device, the rest once by broadcast
+static void test_differing()
+{
+	TestGroup t;
+	LMX2492_Config_TypeDef config[3];
+
+	test_setup(&t);
+	test_config(&config[0], TEST_FOUT);
+	test_config(&config[1], TEST_FOUT + 12345678);
+	test_config(&config[2], TEST_FOUT + 23456789);
+
+	t.group->StageConfig(&config[0]);
+	t.devices[1]->StageConfig(&config[1]);
+
+	CHECK(t.group->Commit());
+	CHECK(t.bc->messages > 0);
+	CHECK(t.sim[0].Messages() > t.bc->messages);
+	CHECK(t.sim[1].Messages() > t.bc->messages);
+
+	// Every byte reaches each device once, either broadcast or per device
+	CHECK(t.sim[0].WrittenBytes() == sizeof(LMX2492_Config_TypeDef));
+	CHECK(t.sim[1].WrittenBytes() == sizeof(LMX2492_Config_TypeDef));
+	CHECK(test_holds(t.sim[0], &config[0]));
+	CHECK(test_holds(t.sim[1], &config[1]));
+	CHECK(!t.sim[0].LatchPending());
+	CHECK(!t.sim[1].LatchPending());
+
+	// Nothing left to write
+	test_reset_counters(&t);
+
+	CHECK(t.group->Commit());
+	CHECK(t.sim[0].Messages() == 0);
+	CHECK(t.sim[1].Messages() == 0);
+
+	// A change of one device is written to that device only
+	t.devices[1]->StageConfig(&config[2]);
+
+	CHECK(t.group->Commit());
+	CHECK(t.bc->messages == 0);
+	CHECK(t.sim[0].Messages() == 0);
+	CHECK(t.sim[1].Messages() == 1);
+	CHECK(test_holds(t.sim[0], &config[0]));
+	CHECK(test_holds(t.sim[1], &config[2]));
+
+	test_teardown(&t);
+}
+
+// A broadcast needs all devices, nothing is sent while another slave owns one
+static void test_owner()
+{
+	TestGroup t;
+	LMX2492_Config_TypeDef config;
+
+	test_setup(&t);
+	test_config(&config, TEST_FOUT);
+	t.group->StageConfig(&config);
+
+	TestHolder holder(&t.sim[1]);
+	CHECK(holder.SpiStart());
+
+	CHECK(!t.group->Commit());
+	CHECK(t.bc->messages == 1);
+	CHECK(t.sim[0].Messages() == 0);
+	CHECK(t.sim[1].Messages() == 0);
+
+	// Released again after the failed broadcast
+	CHECK(holder.SpiEnd());
+	test_reset_counters(&t);
+
+	CHECK(t.group->Commit());
+	CHECK(t.sim[0].Messages() == t.bc->messages);
+	CHECK(test_holds(t.sim[0], &config));
+	CHECK(test_holds(t.sim[1], &config));
+
+	// Released after the broadcast, the devices can be used directly
+	CHECK(holder.SpiStart());
+	CHECK(holder.SpiEnd());
+
+	test_teardown(&t);
+}
+
+int main()
+{
+	test_common();
+	test_differing();
+	test_owner();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,103 @@
+/*
+ * test_hop.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of LMX2492HopTable and LMX2492Driver::Hop() against LMX2492Simulator.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_hop.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_hop && ./test_hop
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_hop_table.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+#define TEST_FREF	32000000
+#define TEST_FOUT	1600000000ULL
+#define TEST_HOPS	4
+
+static const uint64_t test_frequencies[TEST_HOPS] = { 1600000000ULL, 1700123456ULL, 1800000001ULL, 1900500000ULL };
+
+// The table holds the dividers of the runtime builders
+static void test_build()
+{
+	LMX2492_Config_TypeDef config;
+	LMX2492_Hop_TypeDef entries[TEST_HOPS];
+	LMX2492HopTable hops(entries, TEST_HOPS);
+
+	LMX2492Driver::SimpleConfigHz(&config, TEST_FOUT, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+
+	CHECK(hops.Build(&config, TEST_FREF, test_frequencies, TEST_HOPS));
+	CHECK(hops.Count() == TEST_HOPS);
+
+	for(size_t i = 0; i < TEST_HOPS; ++i)
+	{
+		uint32_t N, FRAC_NUM, FRAC_DEN;
+		int64_t error = LMX2492Driver::DividerFromFrequencyHz(test_frequencies[i], TEST_FREF, N, FRAC_NUM, FRAC_DEN);
+
+		CHECK(hops.N(i) == N);
+		CHECK(hops.FracNum(i) == FRAC_NUM);
+		CHECK(hops.FracDen(i) == FRAC_DEN);
+		CHECK(hops.Error(i) == error);
+	}
+
+	// Too small
+	CHECK(!hops.Build(&config, TEST_FREF, test_frequencies, TEST_HOPS + 1));
+	CHECK(hops.Count() == 0);
+}
+
+// Hops write one latched frame and keep the other bits of the config
+static void test_hop()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492_Config_TypeDef config;
+	LMX2492_Hop_TypeDef entries[TEST_HOPS];
+	LMX2492HopTable hops(entries, TEST_HOPS);
+
+	LMX2492Driver::SimpleConfigHz(&config, TEST_FOUT, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+	pll.StageConfig(&config);
+	CHECK(pll.Commit());
+	CHECK(hops.Build(&config, TEST_FREF, test_frequencies, TEST_HOPS));
+
+	// FRAC_DITHER and FRAC_ORDER share register 0x12 with PLL_N[17:16]
+	uint8_t order = sim.Register(0x12) & ~0x03;
+
+	for(size_t i = 0; i < TEST_HOPS; ++i)
+	{
+		sim.ResetCounters();
+
+		CHECK((i % 2 == 0) ? pll.Hop(&hops, i) : pll.HopAsync(&hops, i));
+		CHECK(sim.Frames() == 1);
+		CHECK(sim.WrittenBytes() == LMX2492_HOP_SIZE);
+		CHECK(!sim.LatchPending());
+		CHECK(fabs(sim.Frequency(TEST_FREF) - (double)test_frequencies[i] - hops.Error(i) / 1000.0) < 1.0);
+		CHECK((sim.Register(0x12) & ~0x03) == order);
+	}
+
+	// The shadow follows the hops, the original config is written again
+	sim.ResetCounters();
+	pll.StageConfig(&config);
+
+	CHECK(pll.Commit());
+	CHECK(sim.Messages() > 0);
+	CHECK(!sim.LatchPending());
+	CHECK(fabs(sim.Frequency(TEST_FREF) - (double)TEST_FOUT) < 1.0);
+}
+
+int main()
+{
+	test_build();
+	test_hop();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,177 @@
+/*
+ * test_phase_coder.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of LMX2492PhaseCoder: slot layout, RAMPx_INC of the phase steps and Upload()
+ * against LMX2492Simulator.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_phase_coder.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_phase_coder && ./test_phase_coder
+ */
+
+#include <stdint.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_fields.h"
+#include "lmx2492_phase_coder.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+// Ramp clock = fPFD = 32 MHz, a 1 us chip lasts 32 cycles
+#define TEST_FREF	32000000
+#define TEST_CHIP	1000
+
+static uint32_t INC(const LMX2492PhaseCoder& coder, uint8_t slot) { return (uint32_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_INC>(&coder.Ramps()[slot]); }
+static uint32_t LEN(const LMX2492PhaseCoder& coder, uint8_t slot) { return (uint32_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_LEN>(&coder.Ramps()[slot]); }
+static uint8_t NEXT(const LMX2492PhaseCoder& coder, uint8_t slot) { return (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT>(&coder.Ramps()[slot]); }
+static uint8_t TRIG(const LMX2492PhaseCoder& coder, uint8_t slot) { return (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT_TRIG>(&coder.Ramps()[slot]); }
+
+// Sum of the phase steps in RAMPx_INC LSBs (30 bit two's complement)
+static int64_t test_total_inc(const LMX2492PhaseCoder& coder, uint8_t slots)
+{
+	int64_t total = 0;
+
+	for(uint8_t i = 0; i < slots; ++i)
+		total += (INC(coder, i) & 0x20000000) ? (int64_t)INC(coder, i) - 0x40000000 : (int64_t)INC(coder, i);
+
+	return total;
+}
+
+// Barker 13 = +++++ -- ++ - + - + has 7 runs of equal chips, each step is 180 degrees
+static void test_barker13()
+{
+	LMX2492PhaseCoder coder(TEST_FREF);
+	static const uint16_t runs[7] = { 5, 2, 2, 1, 1, 1, 1 };
+
+	CHECK(coder.CompileBinary(LMX2492PhaseCoder::Barker(13), 13, TEST_CHIP, true, LMX2492_RAMPx_NEXT_TRIG_TRIG_A));
+	CHECK(coder.Slots() == 7);
+	CHECK(coder.TimingError() == 0);
+
+	// The last chip and the first one are both at 0 degrees
+	CHECK(INC(coder, 0) == 0);
+	CHECK(coder.PhaseStep(0) == 0);
+
+	for(uint8_t i = 0; i < 7; ++i)
+	{
+		CHECK(LEN(coder, i) == runs[i] * 32u);
+
+		if(i > 0)
+		{
+			CHECK(INC(coder, i) == (1u << 23));
+			CHECK(coder.PhaseStep(i) == 180000);
+		}
+	}
+
+	// Six 180 degree steps per repetition, back at the start phase
+	CHECK(test_total_inc(coder, 7) == 3 * LMX2492_PM_INC_CYCLE);
+
+	// Repeated from the last slot after the trigger
+	CHECK(NEXT(coder, 5) == 6);
+	CHECK(NEXT(coder, 6) == 0);
+	CHECK(TRIG(coder, 6) == LMX2492_RAMPx_NEXT_TRIG_TRIG_A);
+
+	// Not repeated: no step into the first chip, the last phase is held in an extra slot
+	CHECK(coder.CompileBinary(LMX2492PhaseCoder::Barker(13), 13, TEST_CHIP, false));
+	CHECK(coder.Slots() == 8);
+	CHECK(INC(coder, 0) == 0);
+	CHECK(INC(coder, 7) == 0);
+	CHECK(LEN(coder, 7) == 2);
+	CHECK(NEXT(coder, 7) == 7);
+	CHECK(TRIG(coder, 6) == LMX2492_RAMPx_NEXT_TRIG_NONE);
+
+	// All Barker codes fit, other lengths are unknown
+	static const uint8_t lengths[] = { 2, 3, 4, 5, 7, 11, 13 };
+
+	for(size_t i = 0; i < sizeof(lengths); ++i)
+		CHECK(coder.CompileBinary(LMX2492PhaseCoder::Barker(lengths[i]), lengths[i], TEST_CHIP));
+
+	CHECK(LMX2492PhaseCoder::Barker(6) == NULL);
+}
+
+// Rounding errors of the steps do not add up, PhaseStep() reports the steps
+static void test_phase_steps()
+{
+	LMX2492PhaseCoder coder(TEST_FREF);
+
+	// 120 degrees = 5592405.33 LSBs
+	const int32_t three[] = { 0, 120000, 240000 };
+
+	CHECK(coder.Compile(three, 3, TEST_CHIP));
+	CHECK(coder.Slots() == 3);
+	CHECK(INC(coder, 0) == 5592405);
+	CHECK(INC(coder, 1) == 5592406);
+	CHECK(INC(coder, 2) == 5592405);
+	CHECK(test_total_inc(coder, 3) == LMX2492_PM_INC_CYCLE);
+
+	for(uint8_t i = 0; i < 3; ++i)
+		CHECK(coder.PhaseStep(i) == 120000);
+
+	// Steps are taken the short way round, negative steps are two's complement
+	const int32_t quadrature[] = { 0, 270000 };
+
+	CHECK(coder.Compile(quadrature, 2, TEST_CHIP));
+	CHECK(INC(coder, 0) == (1u << 22));
+	CHECK(INC(coder, 1) == 0x40000000 - (1u << 22));
+	CHECK(coder.PhaseStep(0) == 90000);
+	CHECK(coder.PhaseStep(1) == -90000);
+	CHECK(test_total_inc(coder, 2) == 0);
+}
+
+// Runs must last 1 ... 0xFFFF ramp clocks and fit the eight slots
+static void test_reject()
+{
+	LMX2492PhaseCoder coder(TEST_FREF);
+	const int32_t code[] = { 0, 180000 };
+
+	// 2047968 ns = 65534.98 cycles
+	CHECK(coder.Compile(code, 2, 2047968));
+	CHECK(LEN(coder, 0) == 0xFFFF);
+
+	// 2048000 ns = 65536 cycles
+	CHECK(!coder.Compile(code, 2, 2048000));
+
+	// 10 ns = 0.32 cycles
+	CHECK(!coder.Compile(code, 2, 10));
+
+	// Nine runs
+	const int8_t alternating[] = { 1, -1, 1, -1, 1, -1, 1, -1, 1 };
+
+	CHECK(coder.CompileBinary(alternating, 8, TEST_CHIP));
+	CHECK(!coder.CompileBinary(alternating, 9, TEST_CHIP));
+	CHECK(!coder.CompileBinary(alternating, 8, TEST_CHIP, false));
+}
+
+// One commit writes the slots and enables PM
+static void test_upload()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492PhaseCoder coder(TEST_FREF);
+	LMX2492_Ramp_Config_TypeDef ramp_config, written;
+
+	LMX2492Driver::SimpleRampConfig(&ramp_config, LMX2492_RAMP_EN_ENABLE, LMX2492_RAMP_CLK_PD, 0, 0);
+
+	CHECK(coder.CompileBinary(LMX2492PhaseCoder::Barker(13), 13, TEST_CHIP));
+	CHECK(coder.Upload(&pll, &ramp_config));
+
+	sim.RampConfig(&written);
+	CHECK(LMX2492FieldGet<LMX2492_FIELD_RAMP_PM_EN>((const uint8_t*)&written, LMX2492_RAMP_CONFIG_ADDRESS) == LMX2492_RAMP_PM_EN_PM);
+	CHECK(sim.RampIncrement(1) == (1 << 23));
+	CHECK(sim.RampLength(0) == 160);
+	CHECK(sim.RampLength(6) == 32);
+}
+
+int main()
+{
+	test_barker13();
+	test_phase_steps();
+	test_reject();
+	test_upload();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,155 @@
+/*
+ * test_plan.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of the compile time builders of lmx2492_plan.h: a LMX2492Image declared
+ * static constexpr is checked by static_assert, its frames are compared with the runtime
+ * builders and EncodeFrame() and written to LMX2492Simulator.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_plan.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_plan && ./test_plan
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_plan.h"
+#include "lmx2492_sequence.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+#define TEST_FREF		32000000
+#define TEST_FOUT		1700123456ULL
+#define TEST_RAMP_DF	100000000LL
+#define TEST_RAMP_NS	1000000
+#define TEST_IMAGE_SIZE	128
+
+// Integer divider: 1.6 GHz / 32 MHz
+static constexpr LMX2492Bytes<LMX2492_CONFIG_SIZE> test_config_int = LMX2492Plan::SimpleConfig(1600000000ULL, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+
+static_assert(LMX2492FieldGet<LMX2492_FIELD_PLL_N>(test_config_int.data, LMX2492_CONFIG_ADDRESS) == 50, "PLL_N");
+static_assert(LMX2492FieldGet<LMX2492_FIELD_FRAC_NUM>(test_config_int.data, LMX2492_CONFIG_ADDRESS) == 0, "FRAC_NUM");
+static_assert(LMX2492FieldGet<LMX2492_FIELD_FRAC_DEN>(test_config_int.data, LMX2492_CONFIG_ADDRESS) == 1, "FRAC_DEN");
+static_assert(LMX2492FieldGet<LMX2492_FIELD_CPG>(test_config_int.data, LMX2492_CONFIG_ADDRESS) == LMX2492_CPG_1600UA, "CPG");
+
+// 100 MHz in 1 ms: LEN = 32000, INC = 100 / 32 * 2^24 / 32000 = 1638.4
+static constexpr LMX2492Bytes<LMX2492_RAMP_SIZE> test_ramp_bytes()
+{
+	uint32_t INC = 0;
+	uint16_t LEN = 0;
+
+	LMX2492Plan::RampFromFrequency(TEST_RAMP_DF, TEST_FREF, TEST_RAMP_NS, INC, LEN);
+
+	return LMX2492Plan::SimpleRamp(INC, LEN, 0, LMX2492_RAMPx_RST_ENABLE);
+}
+
+static constexpr LMX2492Bytes<LMX2492_RAMP_SIZE> test_ramp = test_ramp_bytes();
+
+static_assert(LMX2492FieldGet<LMX2492_FIELD_RAMP0_INC>(test_ramp.data, LMX2492_RAMP_ADDRESS(0)) == 1638, "RAMP0_INC");
+static_assert(LMX2492FieldGet<LMX2492_FIELD_RAMP0_LEN>(test_ramp.data, LMX2492_RAMP_ADDRESS(0)) == 32000, "RAMP0_LEN");
+static_assert(LMX2492FieldGet<LMX2492_FIELD_RAMP0_RST>(test_ramp.data, LMX2492_RAMP_ADDRESS(0)) == 1, "RAMP0_RST");
+
+// Boot sequence: reset, config, ramp config, ramp 0, power up
+static constexpr LMX2492Image<TEST_IMAGE_SIZE> test_build_image()
+{
+	LMX2492Image<TEST_IMAGE_SIZE> image;
+
+	image.Reset()
+		.Write(LMX2492_CONFIG_ADDRESS, LMX2492Plan::SimpleConfig(TEST_FOUT, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0))
+		.Write(LMX2492_RAMP_CONFIG_ADDRESS, LMX2492Plan::SimpleRampConfig(LMX2492_RAMP_EN_ENABLE, LMX2492_RAMP_CLK_PD, 0, 0))
+		.Write(LMX2492_RAMP_ADDRESS(0), test_ramp)
+		.PowerConfig(LMX2492_POWERDOWN_POWER_UP);
+
+	return image;
+}
+
+static constexpr LMX2492Image<TEST_IMAGE_SIZE> test_image = test_build_image();
+
+// Frame offsets: length byte, 2 header bytes, data
+#define TEST_CONFIG_FRAME		4
+#define TEST_RAMP_CONFIG_FRAME	(TEST_CONFIG_FRAME + 3 + LMX2492_CONFIG_SIZE)
+#define TEST_RAMP_FRAME			(TEST_RAMP_CONFIG_FRAME + 3 + LMX2492_RAMP_CONFIG_SIZE)
+#define TEST_POWER_FRAME		(TEST_RAMP_FRAME + 3 + LMX2492_RAMP_SIZE)
+
+static_assert(test_image.Size() == TEST_POWER_FRAME + 4, "Image size");
+static_assert((test_image.Data()[0] == 3) && (test_image.Data()[2] == LMX2492_SWRST_ADDR) && (test_image.Data()[3] == LMX2492_SWRST_RESET), "Reset frame");
+static_assert(test_image.Data()[TEST_CONFIG_FRAME] == LMX2492_CONFIG_SIZE + 2, "Config frame length");
+static_assert(test_image.Data()[TEST_CONFIG_FRAME + 2] == LMX2492_CONFIG_ADDRESS + LMX2492_CONFIG_SIZE - 1, "Config frame header");
+static_assert(test_image.Data()[TEST_RAMP_FRAME + 2] == LMX2492_RAMP_ADDRESS(0) + LMX2492_RAMP_SIZE - 1, "Ramp frame header");
+// Highest address first: RAMP0_NEXT, NEXT_TRIG, RST in 0x5C
+static_assert(test_image.Data()[TEST_RAMP_FRAME + 3] == test_ramp.data[LMX2492_RAMP_SIZE - 1], "Ramp frame order");
+static_assert(test_image.Data()[TEST_POWER_FRAME + 3] == LMX2492_POWERDOWN_POWER_UP, "Power frame");
+
+// Frame at offset equals EncodeFrame() of the runtime builder output
+static bool test_frame_is(size_t offset, uint16_t address, const void* data, size_t size)
+{
+	uint8_t frame[LMX2492_FRAME_MAX_SIZE];
+	size_t frame_size = LMX2492Driver::EncodeFrame(address, (const uint8_t*)data, size, frame);
+
+	return (test_image.Data()[offset] == frame_size) && (memcmp(&test_image.Data()[offset + 1], frame, frame_size) == 0);
+}
+
+// The constexpr builders produce the bytes of the runtime builders
+static void test_builders()
+{
+	LMX2492_Config_TypeDef config;
+	LMX2492_Ramp_Config_TypeDef ramp_config;
+	LMX2492_GPIO_Config_TypeDef gpio_config;
+	LMX2492_Ramp_TypeDef ramp;
+
+	LMX2492Driver::SimpleConfigHz(&config, TEST_FOUT, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+	LMX2492Driver::SimpleRampConfig(&ramp_config, LMX2492_RAMP_EN_ENABLE, LMX2492_RAMP_CLK_PD, 0, 0);
+
+	uint32_t INC;
+	uint16_t LEN;
+	LMX2492Driver::RampFromFrequencyHz(TEST_RAMP_DF, TEST_FREF, TEST_RAMP_NS, INC, LEN);
+	LMX2492Driver::SimpleRamp(&ramp, INC, LEN, 0, LMX2492_RAMPx_RST_ENABLE);
+
+	CHECK(memcmp(&config, LMX2492Plan::SimpleConfig(TEST_FOUT, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0).data, LMX2492_CONFIG_SIZE) == 0);
+	CHECK(memcmp(&ramp_config, LMX2492Plan::SimpleRampConfig(LMX2492_RAMP_EN_ENABLE, LMX2492_RAMP_CLK_PD, 0, 0).data, LMX2492_RAMP_CONFIG_SIZE) == 0);
+	CHECK(memcmp(&ramp, test_ramp.data, LMX2492_RAMP_SIZE) == 0);
+
+	LMX2492Driver::SimpleGPIOConfig(&gpio_config, LMX2492_MUX_IN_MOD, LMX2492_PIN_INPUT, LMX2492_MUX_IN_TRIG1, LMX2492_PIN_INPUT);
+	CHECK(memcmp(&gpio_config, LMX2492Plan::SimpleGPIOConfig(LMX2492_MUX_IN_MOD, LMX2492_PIN_INPUT, LMX2492_MUX_IN_TRIG1, LMX2492_PIN_INPUT).data, LMX2492_GPIO_CONFIG_SIZE) == 0);
+
+	// Frames of the image
+	uint8_t rst = LMX2492_SWRST_RESET;
+	uint8_t pwr = LMX2492_POWERDOWN_POWER_UP;
+
+	CHECK(test_frame_is(0, LMX2492_SWRST_ADDR, &rst, 1));
+	CHECK(test_frame_is(TEST_CONFIG_FRAME, LMX2492_CONFIG_ADDRESS, &config, LMX2492_CONFIG_SIZE));
+	CHECK(test_frame_is(TEST_RAMP_CONFIG_FRAME, LMX2492_RAMP_CONFIG_ADDRESS, &ramp_config, LMX2492_RAMP_CONFIG_SIZE));
+	CHECK(test_frame_is(TEST_RAMP_FRAME, LMX2492_RAMP_ADDRESS(0), &ramp, LMX2492_RAMP_SIZE));
+	CHECK(test_frame_is(TEST_POWER_FRAME, LMX2492_POWERDOWN_ADDR, &pwr, 1));
+}
+
+// The image is written as it is
+static void test_write_image()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492Sequence sequence(test_image.Data(), test_image.Size());
+
+	CHECK(sequence.Count() == 5);
+	CHECK(pll.WriteSequence(&sequence));
+	CHECK(sim.Frames() == 5);
+	CHECK(!sim.LatchPending());
+	CHECK(fabs(sim.Frequency(TEST_FREF) - (double)TEST_FOUT) < 1.0);
+	CHECK(sim.RampIncrement(0) == 1638);
+	CHECK(sim.RampLength(0) == 32000);
+}
+
+int main()
+{
+	test_builders();
+	test_write_image();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,140 @@
+/*
+ * test_ramp_bank.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of the ping-pong ramp banks of LMX2492Driver against LMX2492Simulator.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_ramp_bank.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_ramp_bank && ./test_ramp_bank
+ */
+
+#include <stdint.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_sequence.h"
+#include "lmx2492_fields.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+#define TEST_SEQUENCE_SIZE	512
+
+// Loop of two ramps in a bank, NEXT is relative to the bank
+static void test_bank(LMX2492_Ramp_TypeDef* ramps, uint32_t INC)
+{
+	LMX2492Driver::SimpleRamp(&ramps[0], INC, 100, 1);
+	LMX2492Driver::SimpleRamp(&ramps[1], (uint32_t)-INC & 0x3FFFFFFF, 100, 0);
+}
+
+static uint8_t ramp_next(const LMX2492Simulator& sim, uint8_t slot)
+{
+	LMX2492_Ramp_TypeDef ramp;
+	sim.Ramp(&ramp, slot);
+
+	return (uint8_t)LMX2492RampFieldGet<LMX2492_FIELD_RAMP0_NEXT>(&ramp);
+}
+
+// Bank switches redirect the jumps of the active bank and fail without a program to switch to
+static void test_bank_switch()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492_Ramp_TypeDef ramps[LMX2492_RAMP_COUNT];
+	LMX2492_Ramp_TypeDef bank[2];
+	uint8_t buffer[TEST_SEQUENCE_SIZE];
+	LMX2492Sequence sequence(buffer, sizeof(buffer));
+
+	// No bank written
+	CHECK(!pll.SwitchRampBank());
+
+	// Ramps not written by WriteRampBank()
+	for(uint8_t i = 0; i < LMX2492_RAMP_COUNT; ++i)
+		LMX2492Driver::SimpleRamp(&ramps[i], 100, 10, (i + 1) % LMX2492_RAMP_COUNT);
+
+	CHECK(pll.WriteRamps(ramps));
+	test_bank(bank, 200);
+	CHECK(pll.WriteRampBank(1, bank, 2));
+	CHECK(!pll.SwitchRampBank());
+	CHECK(pll.ActiveRampBank() == 0);
+
+	// Both banks written
+	test_bank(bank, 100);
+	CHECK(pll.WriteRampBank(0, bank, 2));
+	CHECK(ramp_next(sim, 1) == 0);
+	CHECK(ramp_next(sim, LMX2492_RAMP_BANK_SIZE + 1) == LMX2492_RAMP_BANK_SIZE);
+
+	sim.ResetCounters();
+
+	CHECK(pll.SwitchRampBank());
+	CHECK(pll.ActiveRampBank() == 1);
+	CHECK(ramp_next(sim, 0) == 1);
+	CHECK(ramp_next(sim, 1) == LMX2492_RAMP_BANK_SIZE);
+	CHECK(sim.WrittenBytes() == 1);
+
+	// Not while recording
+	pll.BeginRecord(&sequence);
+	CHECK(!pll.SwitchRampBank());
+	CHECK(pll.EndRecord());
+
+	// Back to bank 0 after it was rewritten
+	test_bank(bank, 300);
+	CHECK(pll.WriteRampBank(0, bank, 2));
+	CHECK(pll.SwitchRampBank());
+	CHECK(pll.ActiveRampBank() == 0);
+	CHECK(ramp_next(sim, LMX2492_RAMP_BANK_SIZE + 1) == 0);
+	CHECK(sim.RampIncrement(0) == 300);
+}
+
+// Other writes to the slots of a bank invalidate it, the switch would redirect a foreign program
+static void test_bank_overwritten()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492_Ramp_TypeDef ramps[LMX2492_RAMP_COUNT];
+	LMX2492_Ramp_TypeDef bank[2];
+	uint8_t next = 0;
+
+	for(uint8_t i = 0; i < LMX2492_RAMP_COUNT; ++i)
+		LMX2492Driver::SimpleRamp(&ramps[i], 100 + i, 10, (i + 1) % LMX2492_RAMP_COUNT);
+
+	// WriteRamps
+	test_bank(bank, 100);
+	CHECK(pll.WriteRampBank(0, bank, 2));
+	CHECK(pll.WriteRampBank(1, bank, 2));
+	CHECK(pll.WriteRamps(ramps));
+	sim.ResetCounters();
+	CHECK(!pll.SwitchRampBank());
+	CHECK(sim.Messages() == 0);
+
+	// StageRamps and Commit
+	CHECK(pll.WriteRampBank(0, bank, 2));
+	CHECK(pll.WriteRampBank(1, bank, 2));
+	pll.StageRamp(&ramps[LMX2492_RAMP_BANK_SIZE], LMX2492_RAMP_BANK_SIZE);
+	CHECK(pll.Commit());
+	CHECK(!pll.SwitchRampBank());
+
+	// Asynchronous write of a single NEXT byte
+	CHECK(pll.WriteRampBank(1, bank, 2));
+	CHECK(pll.WriteMemoryAsync(LMX2492_RAMP_LAST_ADDRESS(0), &next, 1));
+	CHECK(!pll.SwitchRampBank());
+
+	// Writes outside the ramp slots keep the banks
+	uint8_t cpg = 1;
+	CHECK(pll.WriteRampBank(0, bank, 2));
+	pll.StageMemory(0x1C, &cpg, 1);
+	CHECK(pll.Commit());
+	CHECK(pll.SwitchRampBank());
+	CHECK(pll.ActiveRampBank() == 1);
+}
+
+int main()
+{
+	test_bank_switch();
+	test_bank_overwritten();
+
+	return TEST_RESULT();
+}
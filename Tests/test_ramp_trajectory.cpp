@@ -0,0 +1,195 @@
+/*
+ * test_ramp_trajectory.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of LMX2492RampTrajectory against hand computed ramp engine walks.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_ramp_trajectory.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_ramp_trajectory && ./test_ramp_trajectory
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_fields.h"
+#include "lmx2492_ramp_trajectory.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+// fPFD = 2^24 Hz: one INC LSB is 1 Hz, times are exact multiples of T
+#define TEST_FPFD	16777216.0
+#define T			(1.0 / TEST_FPFD)
+
+#define TEST_INC(x)	((uint32_t)(x) & 0x3FFFFFFF)
+
+static LMX2492_Ramp_TypeDef ramps[LMX2492_RAMP_COUNT];
+static LMX2492_Ramp_Config_TypeDef ramp_config;
+
+static void setup()
+{
+	LMX2492Driver::SimpleRampConfig(&ramp_config, LMX2492_RAMP_EN_ENABLE, LMX2492_RAMP_CLK_PD, 0, 0);
+
+	for(uint8_t i = 0; i < LMX2492_RAMP_COUNT; ++i)
+		LMX2492Driver::SimpleRamp(&ramps[i], 0, 0);
+}
+
+// Segment times in cycles of T, frequencies in Hz
+static bool segment_is(const LMX2492_Ramp_Segment_TypeDef& s, double start, double duration, double period, double f_start, double f_step, uint8_t ramp_idx)
+{
+	return (fabs(s.start - start * T) < 1e-15) && (fabs(s.duration - duration * T) < 1e-15) && (fabs(s.period - period * T) < 1e-15)
+			&& (s.f_start == f_start) && (s.f_step == f_step) && (s.ramp_idx == ramp_idx);
+}
+
+// LEN, NEXT, DLY and RST
+static void test_walk()
+{
+	setup();
+	LMX2492Driver::SimpleRamp(&ramps[0], TEST_INC(100), 10, 1, LMX2492_RAMPx_RST_ENABLE);
+	LMX2492Driver::SimpleRamp(&ramps[1], 0, 5, 2, 0, 0, 1);
+	LMX2492Driver::SimpleRamp(&ramps[2], TEST_INC(-50), 4, 0);
+
+	LMX2492RampTrajectory trajectory(&ramp_config, ramps, TEST_FPFD);
+
+	CHECK(trajectory.Build(48 * T) == 6);
+
+	const std::vector<LMX2492_Ramp_Segment_TypeDef>& s = trajectory.Segments();
+	CHECK(segment_is(s[0], 0, 10, 1, 0, 100, 0));
+	CHECK(segment_is(s[1], 10, 10, 2, 1000, 0, 1));
+	CHECK(segment_is(s[2], 20, 4, 1, 1000, -50, 2));
+	CHECK(segment_is(s[3], 24, 10, 1, 0, 100, 0));
+	CHECK(segment_is(s[4], 34, 10, 2, 1000, 0, 1));
+	CHECK(segment_is(s[5], 44, 4, 1, 1000, -50, 2));
+
+	CHECK(trajectory.FrequencyAt(3.5 * T) == 300);
+	CHECK(trajectory.FrequencyAt(22 * T) == 900);
+
+	// Without RST the accumulator continues
+	LMX2492Driver::SimpleRamp(&ramps[0], TEST_INC(100), 10, 1, LMX2492_RAMPx_RST_DISABLE);
+	LMX2492RampTrajectory accumulate(&ramp_config, ramps, TEST_FPFD);
+
+	CHECK(accumulate.Build(48 * T) == 6);
+	CHECK(segment_is(accumulate.Segments()[3], 24, 10, 1, 800, 100, 0));
+	CHECK(segment_is(accumulate.Segments()[5], 44, 4, 1, 1800, -50, 2));
+
+	// Disabled ramp engine
+	LMX2492Driver::SimpleRampConfig(&ramp_config, LMX2492_RAMP_EN_DISABLE, LMX2492_RAMP_CLK_PD, 0, 0);
+	LMX2492RampTrajectory disabled(&ramp_config, ramps, TEST_FPFD);
+
+	CHECK(disabled.Build(48 * T) == 1);
+	CHECK(segment_is(disabled.Segments()[0], 0, 48, 48, 0, 0, 0));
+}
+
+// The accumulator stops at the ramp limits for the rest of the slot
+static void test_limit()
+{
+	setup();
+	uint8_t *rc = (uint8_t*)&ramp_config;
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_LIMIT_HIGH>(rc, LMX2492_RAMP_CONFIG_ADDRESS, 500);
+	LMX2492FieldSet<LMX2492_FIELD_RAMP_LIMIT_LOW>(rc, LMX2492_RAMP_CONFIG_ADDRESS, 0x200000000ULL - 120);
+
+	LMX2492Driver::SimpleRamp(&ramps[0], TEST_INC(100), 10, 1);
+	LMX2492Driver::SimpleRamp(&ramps[1], TEST_INC(-200), 4, 1);
+
+	LMX2492RampTrajectory trajectory(&ramp_config, ramps, TEST_FPFD);
+
+	CHECK(trajectory.Build(18 * T) == 5);
+
+	const std::vector<LMX2492_Ramp_Segment_TypeDef>& s = trajectory.Segments();
+	CHECK(segment_is(s[0], 0, 5, 1, 0, 100, 0));
+	CHECK(segment_is(s[1], 5, 5, 5, 500, 0, 0));
+	// 500 - 3 * 200 < -120
+	CHECK(segment_is(s[2], 10, 3, 1, 500, -200, 1));
+	CHECK(segment_is(s[3], 13, 1, 1, -120, 0, 1));
+	// Already at the low limit
+	CHECK(segment_is(s[4], 14, 4, 4, -120, 0, 1));
+}
+
+// NEXT_TRIG holds until the next trigger event, forever without one
+static void test_trigger()
+{
+	setup();
+	LMX2492Driver::SimpleRamp(&ramps[0], 0, 2, 1, 0, LMX2492_RAMPx_NEXT_TRIG_TRIG_A);
+	LMX2492Driver::SimpleRamp(&ramps[1], TEST_INC(10), 8, 0);
+
+	LMX2492RampTrajectory trajectory(&ramp_config, ramps, TEST_FPFD);
+	const double triggers[] = { 300 * T, 100 * T };
+	trajectory.SetTrigger(LMX2492_RAMPx_NEXT_TRIG_TRIG_A, triggers, 2);
+
+	CHECK(trajectory.Build(400 * T) == 8);
+
+	const std::vector<LMX2492_Ramp_Segment_TypeDef>& s = trajectory.Segments();
+	CHECK(segment_is(s[0], 0, 2, 1, 0, 0, 0));
+	CHECK(segment_is(s[1], 2, 98, 98, 0, 0, 0));
+	CHECK(segment_is(s[2], 100, 8, 1, 0, 10, 1));
+	CHECK(segment_is(s[3], 108, 2, 1, 80, 0, 0));
+	CHECK(segment_is(s[4], 110, 190, 190, 80, 0, 0));
+	CHECK(segment_is(s[5], 300, 8, 1, 80, 10, 1));
+	CHECK(segment_is(s[6], 308, 2, 1, 160, 0, 0));
+	CHECK(segment_is(s[7], 310, 90, 90, 160, 0, 0));
+
+	// Sample() matches FrequencyAt() on and between the steps
+	const double fs = TEST_FPFD / 2.5;
+	double f[200];
+	trajectory.Sample(0, fs, f, 200);
+
+	bool match = true;
+
+	for(size_t i = 0; i < 200; ++i)
+		match &= (f[i] == trajectory.FrequencyAt(i / fs));
+
+	CHECK(match);
+	CHECK(f[41] == 20);
+	CHECK(f[199] == 160);
+}
+
+// Linear chirp of 32768 steps of 1 kHz, followed by a hold
+static void test_analyze()
+{
+	setup();
+	LMX2492Driver::SimpleRamp(&ramps[0], TEST_INC(1000), 32768, 1, LMX2492_RAMPx_RST_ENABLE);
+	LMX2492Driver::SimpleRamp(&ramps[1], 0, 100, 0);
+
+	LMX2492RampTrajectory trajectory(&ramp_config, ramps, TEST_FPFD);
+	trajectory.Build(2 * 32868 * T);
+
+	LMX2492_Chirp_TypeDef chirp = { 0, 32768 * T, 0, 32768000.0 };
+
+	// Sampled on every fourth step the staircase is exactly linear
+	LMX2492_Chirp_Report_TypeDef report = trajectory.Analyze(&chirp, TEST_FPFD / 4);
+
+	CHECK(fabs(report.slope - 1000 * TEST_FPFD) < 1e-3);
+	CHECK(fabs(report.slope_error) < 1e-12);
+	CHECK(report.linearity_max < 1e-6);
+	CHECK(report.deviation_max < 1e-6);
+	CHECK(report.ramp_start == 0);
+	CHECK(fabs(report.ramp_duration - 32768 * T) < 1e-15);
+	CHECK(report.ramp_df == 32768000.0);
+
+	// Between the steps the staircase deviates by less than one step
+	report = trajectory.Analyze(&chirp, TEST_FPFD / 2.5);
+
+	CHECK(fabs(report.slope_error) < 1e-4);
+	CHECK((report.linearity_max > 0) && (report.linearity_max < 1000));
+	CHECK(report.deviation_max <= 1000);
+
+	// Slope error against a detuned chirp
+	chirp.df = 32768000.0 * 1.01;
+	report = trajectory.Analyze(&chirp, TEST_FPFD / 4);
+
+	CHECK(fabs(report.slope_error - (1 / 1.01 - 1)) < 1e-9);
+}
+
+int main()
+{
+	test_walk();
+	test_limit();
+	test_trigger();
+	test_analyze();
+
+	return TEST_RESULT();
+}
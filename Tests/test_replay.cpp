@@ -0,0 +1,104 @@
+/*
+ * test_replay.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of recorded sequences of LMX2492Driver against LMX2492Simulator: recording,
+ * Replay() as chained transfer and WriteSequence().
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_replay.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_replay && ./test_replay
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_sequence.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+#define TEST_FREF			32000000
+#define TEST_FOUT			1600000000ULL
+#define TEST_SEQUENCE_SIZE	512
+
+// A recorded sequence is not transmitted, its replay writes it and updates the shadow
+static void test_replay()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492_Config_TypeDef config;
+	LMX2492_Ramp_TypeDef ramps[LMX2492_RAMP_COUNT];
+	uint8_t buffer[TEST_SEQUENCE_SIZE];
+	LMX2492Sequence sequence(buffer, sizeof(buffer));
+
+	LMX2492Driver::SimpleConfigHz(&config, TEST_FOUT, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+
+	for(uint8_t i = 0; i < LMX2492_RAMP_COUNT; ++i)
+		LMX2492Driver::SimpleRamp(&ramps[i], 1000 * (i + 1), 50, (i + 1) % LMX2492_RAMP_COUNT);
+
+	pll.BeginRecord(&sequence);
+	pll.StageConfig(&config);
+	pll.StageRamps(ramps);
+	CHECK(pll.Commit());
+	CHECK(pll.EndRecord());
+
+	CHECK(sim.Messages() == 0);
+	CHECK(sequence.Count() > 0);
+
+	CHECK(pll.Replay(&sequence));
+	CHECK(sim.Messages() == 1);
+	CHECK(sim.Frames() == sequence.Count());
+	CHECK(!sim.LatchPending());
+	CHECK(sim.OrderViolations() == 0);
+	CHECK(fabs(sim.Frequency(TEST_FREF) - (double)TEST_FOUT) < 1.0);
+	CHECK(sim.RampIncrement(7) == 8000);
+
+	// The replayed registers are known, nothing is resent
+	sim.ResetCounters();
+	pll.StageConfig(&config);
+	pll.StageRamps(ramps);
+
+	CHECK(pll.Commit());
+	CHECK(sim.Messages() == 0);
+
+	// Blocking replay into a device that lost its registers
+	sim.PowerOnReset();
+	sim.ResetCounters();
+
+	CHECK(pll.WriteSequence(&sequence));
+	CHECK(sim.Frames() == sequence.Count());
+	CHECK(fabs(sim.Frequency(TEST_FREF) - (double)TEST_FOUT) < 1.0);
+}
+
+// A sequence too small for the recorded frames fails on EndRecord()
+static void test_record_overflow()
+{
+	LMX2492Simulator sim;
+	LMX2492Driver pll(&sim, NULL, 0);
+	LMX2492_Ramp_TypeDef ramps[LMX2492_RAMP_COUNT];
+	uint8_t buffer[16];
+	LMX2492Sequence sequence(buffer, sizeof(buffer));
+
+	for(uint8_t i = 0; i < LMX2492_RAMP_COUNT; ++i)
+		LMX2492Driver::SimpleRamp(&ramps[i], 1, 50, 0);
+
+	pll.BeginRecord(&sequence);
+	pll.StageRamps(ramps);
+	pll.Commit();
+
+	CHECK(!pll.EndRecord());
+	CHECK(sim.Messages() == 0);
+}
+
+int main()
+{
+	test_replay();
+	test_record_overflow();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,222 @@
+/*
+ * test_scheduler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of LMX2492Scheduler on the Linux backend against LMX2492Simulator: chaining of
+ * jobs on a shared bus, failed jobs and the shadow update of committed jobs.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_scheduler.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_scheduler && ./test_scheduler
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_scheduler.h"
+#include "lmx2492_sequence.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+#define TEST_FREF			32000000
+#define TEST_FOUT			1600000000ULL
+#define TEST_FOUT_C			1700000000ULL
+#define TEST_SEQUENCE_SIZE	256
+#define TEST_LOG_SIZE		16
+
+// Devices in the order of their messages
+static uint8_t test_log[TEST_LOG_SIZE];
+static size_t test_log_count;
+
+// Simulator logging its messages, the next fail ones fail
+class TestLogDevice : public LMX2492Simulator
+{
+public:
+	explicit TestLogDevice(uint8_t id) : id(id), fail(0) { }
+
+	virtual bool Transfer(const struct spi_ioc_transfer* segments, size_t count)
+	{
+		if(test_log_count < TEST_LOG_SIZE)
+			test_log[test_log_count++] = id;
+
+		if(fail > 0)
+		{
+			--fail;
+			return false;
+		}
+
+		return LMX2492Simulator::Transfer(segments, count);
+	}
+
+	uint8_t id;
+	uint32_t fail;
+};
+
+// Jobs A and C share bus 0, job B runs on bus 1
+typedef struct {
+	TestLogDevice* bus[2];
+	LMX2492Driver* pll[3];
+	uint8_t buffer[3][TEST_SEQUENCE_SIZE];
+	LMX2492Sequence* sequence[3];
+	LMX2492_Job_TypeDef jobs[3];
+	LMX2492Scheduler* scheduler;
+} TestJobs;
+
+static void test_setup(TestJobs* t)
+{
+	LMX2492_Config_TypeDef config;
+
+	t->bus[0] = new TestLogDevice(0);
+	t->bus[1] = new TestLogDevice(1);
+	t->pll[0] = new LMX2492Driver(t->bus[0], NULL, 0);
+	t->pll[1] = new LMX2492Driver(t->bus[1], NULL, 0);
+	t->pll[2] = new LMX2492Driver(t->bus[0], NULL, 0);
+	t->scheduler = new LMX2492Scheduler(t->jobs, 3);
+
+	for(uint8_t i = 0; i < 3; ++i)
+	{
+		t->sequence[i] = new LMX2492Sequence(t->buffer[i], TEST_SEQUENCE_SIZE);
+
+		LMX2492Driver::SimpleConfigHz(&config, (i == 2) ? TEST_FOUT_C : TEST_FOUT, TEST_FREF, LMX2492_CPPOL_POSITIVE, LMX2492_CPG_1600UA, 1, 0);
+		t->pll[i]->StageConfig(&config);
+	}
+
+	test_log_count = 0;
+}
+
+static void test_teardown(TestJobs* t)
+{
+	delete t->scheduler;
+
+	for(uint8_t i = 0; i < 3; ++i)
+	{
+		delete t->sequence[i];
+		delete t->pll[i];
+	}
+
+	delete t->bus[1];
+	delete t->bus[0];
+}
+
+// Number of frames AddCommit() records for a driver, zero if its shadow is up to date
+static size_t test_dirty_frames(LMX2492Driver* pll)
+{
+	uint8_t buffer[TEST_SEQUENCE_SIZE];
+	LMX2492Sequence sequence(buffer, sizeof(buffer));
+	LMX2492_Job_TypeDef jobs[1];
+	LMX2492Scheduler probe(jobs, 1);
+
+	if(!probe.AddCommit(pll, &sequence))
+		return 0;
+
+	return sequence.Count();
+}
+
+// Jobs on a shared bus run one after another, the next one started from the complete callback
+static void test_chain()
+{
+	TestJobs t;
+	test_setup(&t);
+
+	for(uint8_t i = 0; i < 3; ++i)
+		CHECK(t.scheduler->AddCommit(t.pll[i], t.sequence[i]));
+
+	CHECK(t.scheduler->Count() == 3);
+	CHECK(t.jobs[0].first && t.jobs[1].first && !t.jobs[2].first);
+	CHECK(t.jobs[0].next == 2);
+	CHECK(t.jobs[1].next == LMX2492_JOB_NONE);
+
+	// Recorded only, the shadow is not updated before the job is done
+	CHECK(test_log_count == 0);
+	CHECK(t.scheduler->State(0) == LMX2492_JOB_PENDING);
+	CHECK(test_dirty_frames(t.pll[0]) == t.sequence[0]->Count());
+
+	CHECK(t.scheduler->Run());
+	CHECK(t.scheduler->Done());
+	CHECK(t.scheduler->Failures() == 0);
+
+	for(uint8_t i = 0; i < 3; ++i)
+		CHECK(t.scheduler->State(i) == LMX2492_JOB_DONE);
+
+	// C continues the chain of A before the chain of bus 1 starts, one message per job
+	CHECK(test_log_count == 3);
+	CHECK((test_log[0] == 0) && (test_log[1] == 0) && (test_log[2] == 1));
+	CHECK(fabs(t.bus[0]->Frequency(TEST_FREF) - (double)TEST_FOUT_C) < 1.0);
+	CHECK(fabs(t.bus[1]->Frequency(TEST_FREF) - (double)TEST_FOUT) < 1.0);
+
+	// Shadows updated by the completed jobs
+	for(uint8_t i = 0; i < 3; ++i)
+		CHECK(test_dirty_frames(t.pll[i]) == 0);
+
+	test_teardown(&t);
+}
+
+// A failed job is reported and the chain of its bus continues
+static void test_failure()
+{
+	TestJobs t;
+	test_setup(&t);
+
+	for(uint8_t i = 0; i < 3; ++i)
+		CHECK(t.scheduler->AddCommit(t.pll[i], t.sequence[i]));
+
+	t.bus[0]->fail = 1;
+
+	// Transfers are synchronous, all chains finished when Start() returns
+	CHECK(t.scheduler->Start());
+	CHECK(t.scheduler->Done());
+	CHECK(t.scheduler->Failures() == 1);
+	CHECK(t.scheduler->State(0) == LMX2492_JOB_FAILED);
+	CHECK(t.scheduler->State(1) == LMX2492_JOB_DONE);
+	CHECK(t.scheduler->State(2) == LMX2492_JOB_DONE);
+
+	CHECK(test_log_count == 3);
+	CHECK((test_log[0] == 0) && (test_log[1] == 0) && (test_log[2] == 1));
+	CHECK(fabs(t.bus[0]->Frequency(TEST_FREF) - (double)TEST_FOUT_C) < 1.0);
+
+	// The failed job leaves its changes dirty, the completed ones are known
+	CHECK(test_dirty_frames(t.pll[0]) == t.sequence[0]->Count());
+	CHECK(test_dirty_frames(t.pll[1]) == 0);
+	CHECK(test_dirty_frames(t.pll[2]) == 0);
+
+	// Run again, all jobs succeed
+	test_log_count = 0;
+
+	CHECK(t.scheduler->Run());
+	CHECK(t.scheduler->Failures() == 0);
+	CHECK(test_log_count == 3);
+	CHECK(test_dirty_frames(t.pll[0]) == 0);
+
+	test_teardown(&t);
+}
+
+// Up to date drivers add no job
+static void test_clean()
+{
+	TestJobs t;
+	test_setup(&t);
+
+	CHECK(t.pll[1]->Commit());
+	test_log_count = 0;
+
+	CHECK(t.scheduler->AddCommit(t.pll[1], t.sequence[1]));
+	CHECK(t.scheduler->Count() == 0);
+	CHECK(t.scheduler->Run());
+	CHECK(test_log_count == 0);
+
+	test_teardown(&t);
+}
+
+int main()
+{
+	test_chain();
+	test_failure();
+	test_clean();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,115 @@
+/*
+ * test_spislave.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host test of the asynchronous transfer contract of the Linux SpiSlave backend through
+ * LMX2492Driver: a call that returns true reports the result to the callback only, once.
+ * Build and run on Linux, the exit code is the number of failures:
+ *
+ *   g++ -std=c++14 -Wall -ILMX2492 -ISpiSlave_Linux -ISimulator Tests/test_spislave.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp Simulator/[a-z]*.cpp -o test_spislave && ./test_spislave
+ */
+
+#include <stdint.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_sequence.h"
+#include "lmx2492_simulator.h"
+#include "test_check.h"
+
+using namespace bsp;
+
+#define TEST_SEQUENCE_SIZE	128
+
+// Simulator whose transfers fail on request
+class TestFailingDevice : public LMX2492Simulator
+{
+public:
+	TestFailingDevice() : fail(false) { }
+
+	virtual bool Transfer(const struct spi_ioc_transfer* segments, size_t count)
+	{
+		if(fail) return false;
+
+		return LMX2492Simulator::Transfer(segments, count);
+	}
+
+	bool fail;
+};
+
+// Completion reported to the callback
+typedef struct {
+	uint32_t calls;
+	bool success;
+} TestCompletion;
+
+static void test_callback(void* context, bool success)
+{
+	TestCompletion* completion = (TestCompletion*)context;
+
+	++completion->calls;
+	completion->success = success;
+}
+
+// A started transfer that fails is reported to the callback, the call itself succeeds
+static void test_write_async_failure()
+{
+	TestFailingDevice device;
+	LMX2492Driver pll(&device, NULL, 0);
+	TestCompletion completion = { 0, true };
+	const uint8_t data = 0x5A;
+
+	device.fail = true;
+
+	CHECK(pll.WriteMemoryAsync(LMX2492_RAMP_CONFIG_ADDRESS, &data, 1, test_callback, &completion));
+	CHECK(completion.calls == 1);
+	CHECK(!completion.success);
+	CHECK(!pll.SpiBusy());
+
+	// The bus is released, the next transfer works
+	device.fail = false;
+
+	CHECK(pll.WriteMemoryAsync(LMX2492_RAMP_CONFIG_ADDRESS, &data, 1, test_callback, &completion));
+	CHECK(completion.calls == 2);
+	CHECK(completion.success);
+	CHECK(device.Register(LMX2492_RAMP_CONFIG_ADDRESS) == data);
+}
+
+// Same for a replay
+static void test_replay_failure()
+{
+	TestFailingDevice device;
+	LMX2492Driver pll(&device, NULL, 0);
+	TestCompletion completion = { 0, true };
+	uint8_t buffer[TEST_SEQUENCE_SIZE];
+	LMX2492Sequence sequence(buffer, sizeof(buffer));
+	const uint8_t data = 0x5A;
+
+	pll.BeginRecord(&sequence);
+	pll.StageMemory(LMX2492_RAMP_CONFIG_ADDRESS, &data, 1);
+	CHECK(pll.Commit());
+	CHECK(pll.EndRecord());
+
+	device.fail = true;
+
+	CHECK(pll.Replay(&sequence, test_callback, &completion));
+	CHECK(completion.calls == 1);
+	CHECK(!completion.success);
+
+	device.fail = false;
+
+	CHECK(pll.Replay(&sequence, test_callback, &completion));
+	CHECK(completion.calls == 2);
+	CHECK(completion.success);
+	CHECK(device.Register(LMX2492_RAMP_CONFIG_ADDRESS) == data);
+}
+
+int main()
+{
+	test_write_async_failure();
+	test_replay_failure();
+
+	return TEST_RESULT();
+}
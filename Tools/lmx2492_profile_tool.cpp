@@ -0,0 +1,274 @@
+/*
+ * lmx2492_profile_tool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * Host tool building a LMX2492ProfileLibrary from profile descriptions. Each profile is
+ * staged in a driver on the Linux SpiSlave backend and recorded by Commit(), the library
+ * holds the frames exactly as the driver transmits them. Every profile starts from the POR
+ * values of all configuration registers (0x10 ... 0x27, 0x3A ... 0x8D), the statements only
+ * change them, so activating a profile leaves nothing of the previous one. POWERDOWN and
+ * SWRST (0x02) are written by the power and reset statements only. Build and run on Linux:
+ *
+ *   g++ -std=c++14 -O2 -ILMX2492 -ISpiSlave_Linux Tools/lmx2492_profile_tool.cpp \
+ *       LMX2492/[a-z]*.cpp SpiSlave_Linux/[a-z]*.cpp -o lmx2492_profile_tool
+ *   ./lmx2492_profile_tool profiles.txt profiles.bin [profiles.h symbol]
+ *
+ * The optional header holds the library as aligned const array for linking into flash.
+ * Description format, one statement per line, '#' starts a comment:
+ *
+ *   profile <id>						start a profile, ends at the next profile or end of file
+ *   reset								soft reset before the profile
+ *   fref <Hz>							reference frequency (default 100 MHz)
+ *   config <fout Hz> <CPPOL> <CPG> <R> <OSC_2X>
+ *   gpio <TRIG1_MUX> <TRIG1_PIN> <TRIG2_MUX> <TRIG2_PIN> <MOD_MUX> <MOD_PIN> <MUXout_MUX> <MUXout_PIN>
+ *   ramp_config <RAMP_EN> <RAMP_CLK> <RAMP_TRIGA> <RAMP_COUNT>
+ *   ramp <slot> <df Hz> <duration ns> [<NEXT> <RST> <NEXT_TRIG> <DLY>]
+ *   power <power_config>
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "lmx2492_driver.h"
+#include "lmx2492_profile.h"
+#include "lmx2492_fields.h"
+
+using namespace bsp;
+
+#define TOOL_MAX_PROFILES	1024
+#define TOOL_LIBRARY_SIZE	(1024 * 1024)
+#define TOOL_SEQUENCE_SIZE	1024
+#define TOOL_DEFAULT_FREF	100000000ULL
+
+// Profile being described
+typedef struct {
+	uint32_t id;
+	uint64_t fref;
+	uint64_t fout;
+	uint16_t R;
+	uint8_t OSC_2X;
+	bool reset;
+} ToolProfile;
+
+static uint64_t library[TOOL_LIBRARY_SIZE / sizeof(uint64_t)];
+static uint8_t sequence_buffer[TOOL_SEQUENCE_SIZE];
+
+// Stage the POR values of all configuration registers, the profile statements override them
+static void stage_reset_image(LMX2492Driver* pll)
+{
+	pll->StageMemory(LMX2492_CONFIG_ADDRESS, &LMX2492_RESET_IMAGE.data[LMX2492_CONFIG_ADDRESS],
+			LMX2492_GPIO_CONFIG_LAST_ADDRESS - LMX2492_CONFIG_ADDRESS + 1);
+	pll->StageMemory(LMX2492_RAMP_CONFIG_ADDRESS, &LMX2492_RESET_IMAGE.data[LMX2492_RAMP_CONFIG_ADDRESS],
+			LMX2492_RAMP_LAST_ADDRESS(LMX2492_RAMP_COUNT - 1) - LMX2492_RAMP_CONFIG_ADDRESS + 1);
+}
+
+// Record the staged registers of a profile and add it to the library
+static bool finish_profile(LMX2492Driver* pll, const ToolProfile* profile, LMX2492ProfileBuilder* builder)
+{
+	LMX2492Sequence sequence(sequence_buffer, sizeof(sequence_buffer));
+
+	pll->BeginRecord(&sequence);
+
+	bool success = !profile->reset || pll->Reset();
+	success &= pll->Commit();
+	success &= pll->EndRecord();
+
+	if(!success || !builder->Add(profile->id, profile->fout, &sequence))
+	{
+		fprintf(stderr, "profile %" PRIu32 ": %s\n", profile->id, success ? "duplicate id or library full" : "too many registers");
+		return false;
+	}
+
+	return true;
+}
+
+static bool write_header(const char* path, const char* symbol, const uint8_t* data, size_t size)
+{
+	FILE* f = fopen(path, "w");
+
+	if(f == NULL) return false;
+
+	fprintf(f, "/* Generated by lmx2492_profile_tool, LMX2492ProfileLibrary image */\n\n");
+	fprintf(f, "#include <stdint.h>\n\n");
+	fprintf(f, "static const uint8_t %s[%zu] __attribute__((aligned(%d))) = {", symbol, size, LMX2492_PROFILE_ALIGN);
+
+	for(size_t i = 0; i < size; ++i)
+		fprintf(f, "%s0x%02X,", (i % 16 == 0) ? "\n\t" : " ", data[i]);
+
+	fprintf(f, "\n};\n");
+
+	return fclose(f) == 0;
+}
+
+int main(int argc, char** argv)
+{
+	if((argc != 3) && (argc != 5))
+	{
+		fprintf(stderr, "usage: %s <profiles.txt> <profiles.bin> [<profiles.h> <symbol>]\n", argv[0]);
+		return 2;
+	}
+
+	FILE* in = fopen(argv[1], "r");
+
+	if(in == NULL)
+	{
+		fprintf(stderr, "can not open %s\n", argv[1]);
+		return 1;
+	}
+
+	// Frames are recorded only, the loopback device is never written
+	SpiLoopbackDevice device;
+	LMX2492Driver* pll = NULL;
+	LMX2492ProfileBuilder builder((uint8_t*)library, sizeof(library), TOOL_MAX_PROFILES);
+
+	ToolProfile profile;
+	bool open = false;
+	bool error = false;
+	char line[256];
+	unsigned lineno = 0;
+
+	while(fgets(line, sizeof(line), in) != NULL)
+	{
+		char* comment = strchr(line, '#');
+		char keyword[32];
+		unsigned long long a[8] = { 0 };
+		long long df = 0;
+		int n;
+
+		++lineno;
+
+		if(comment != NULL) *comment = '\0';
+		if(sscanf(line, "%31s", keyword) != 1) continue;
+
+		// Cleared when the statement is complete
+		error = true;
+
+		if(strcmp(keyword, "profile") == 0)
+		{
+			if(open && !finish_profile(pll, &profile, &builder)) return 1;
+
+			memset(&profile, 0, sizeof(profile));
+			profile.fref = TOOL_DEFAULT_FREF;
+			profile.R = 1;
+			open = sscanf(line, "%*s %llu", &a[0]) == 1;
+			profile.id = (uint32_t)a[0];
+
+			// Fresh register image, every profile is recorded completely
+			delete pll;
+			pll = new LMX2492Driver(&device, NULL, 0);
+			stage_reset_image(pll);
+
+			if(!open) break;
+			error = false;
+			continue;
+		}
+
+		if(!open) break;
+
+		if(strcmp(keyword, "reset") == 0)
+		{
+			profile.reset = true;
+		}
+		else if(strcmp(keyword, "fref") == 0)
+		{
+			if(sscanf(line, "%*s %llu", &a[0]) != 1) break;
+			profile.fref = a[0];
+		}
+		else if(strcmp(keyword, "config") == 0)
+		{
+			LMX2492_Config_TypeDef config;
+
+			if(sscanf(line, "%*s %llu %llu %llu %llu %llu", &a[0], &a[1], &a[2], &a[3], &a[4]) != 5) break;
+
+			profile.fout = a[0];
+			profile.R = (uint16_t)a[3];
+			profile.OSC_2X = (uint8_t)a[4];
+
+			int64_t err = LMX2492Driver::SimpleConfigHz(&config, profile.fout, (uint32_t)profile.fref, (uint8_t)a[1], (uint8_t)a[2], profile.R, profile.OSC_2X);
+			pll->StageConfig(&config);
+
+			printf("profile %" PRIu32 ": %" PRIu64 " Hz, error %" PRId64 " mHz\n", profile.id, profile.fout, err);
+		}
+		else if(strcmp(keyword, "gpio") == 0)
+		{
+			LMX2492_GPIO_Config_TypeDef gpio_config;
+
+			if(sscanf(line, "%*s %llu %llu %llu %llu %llu %llu %llu %llu", &a[0], &a[1], &a[2], &a[3], &a[4], &a[5], &a[6], &a[7]) != 8) break;
+
+			LMX2492Driver::SimpleGPIOConfig(&gpio_config, (uint8_t)a[0], (uint8_t)a[1], (uint8_t)a[2], (uint8_t)a[3], (uint8_t)a[4], (uint8_t)a[5], (uint8_t)a[6], (uint8_t)a[7]);
+			pll->StageGPIOConfig(&gpio_config);
+		}
+		else if(strcmp(keyword, "ramp_config") == 0)
+		{
+			LMX2492_Ramp_Config_TypeDef ramp_config;
+
+			if(sscanf(line, "%*s %llu %llu %llu %llu", &a[0], &a[1], &a[2], &a[3]) != 4) break;
+
+			LMX2492Driver::SimpleRampConfig(&ramp_config, (uint8_t)a[0], (uint8_t)a[1], (uint8_t)a[2], (uint16_t)a[3]);
+			pll->StageRampConfig(&ramp_config);
+		}
+		else if(strcmp(keyword, "ramp") == 0)
+		{
+			LMX2492_Ramp_TypeDef ramp;
+			uint32_t INC;
+			uint16_t LEN;
+
+			n = sscanf(line, "%*s %llu %lld %llu %llu %llu %llu %llu", &a[0], &df, &a[1], &a[2], &a[3], &a[4], &a[5]);
+			if(((n != 3) && (n != 7)) || (a[0] >= LMX2492_RAMP_COUNT)) break;
+
+			LMX2492Driver::RampFromFrequencyHz(df, (uint32_t)profile.fref, (uint32_t)a[1], INC, LEN, 0, profile.R, profile.OSC_2X);
+			LMX2492Driver::SimpleRamp(&ramp, INC, LEN, (uint8_t)a[2], (uint8_t)a[3], (uint8_t)a[4], (uint8_t)a[5]);
+			pll->StageRamp(&ramp, (uint8_t)a[0]);
+		}
+		else if(strcmp(keyword, "power") == 0)
+		{
+			if((sscanf(line, "%*s %llu", &a[0]) != 1) || (a[0] > 2)) break;
+
+			pll->StagePowerConfig((uint8_t)a[0]);
+		}
+		else
+		{
+			break;
+		}
+
+		error = false;
+	}
+
+	fclose(in);
+
+	// Loop left early on a malformed statement
+	if(error)
+	{
+		fprintf(stderr, "line %u: invalid statement: %s\n", lineno, line);
+		return 1;
+	}
+
+	if(open && !finish_profile(pll, &profile, &builder)) return 1;
+
+	delete pll;
+
+	size_t size = builder.Finish();
+
+	FILE* out = fopen(argv[2], "wb");
+
+	if((out == NULL) || (fwrite(library, 1, size, out) != size) || (fclose(out) != 0))
+	{
+		fprintf(stderr, "can not write %s\n", argv[2]);
+		return 1;
+	}
+
+	if((argc == 5) && !write_header(argv[3], argv[4], (const uint8_t*)library, size))
+	{
+		fprintf(stderr, "can not write %s\n", argv[3]);
+		return 1;
+	}
+
+	printf("%zu profiles, %zu bytes\n", builder.Count(), size);
+
+	return 0;
+}